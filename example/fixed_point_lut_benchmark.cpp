@@ -0,0 +1,100 @@
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Copyright Christopher Kormanyos 2016.
+
+// This file also includes Doxygen-style documentation about the function of the code.
+// See http://www.doxygen.org for details.
+
+//! \file
+
+//! \brief Example program comparing the run-time of the table-based functions
+//! in namespace boost::fixed_point::lut with the <cmath> functions of negatable.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/fixed_point/fixed_point.hpp>
+
+namespace local
+{
+  template<typename NegatableType, typename FunctionType>
+  double measure_nanoseconds_per_call(const std::vector<NegatableType>& x, FunctionType function)
+  {
+    NegatableType sum(0);
+
+    const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      sum += function(x[i]);
+    }
+
+    const std::chrono::high_resolution_clock::time_point stop = std::chrono::high_resolution_clock::now();
+
+    // Print the sum in order to keep the calculations from being optimized away.
+    std::cout << ((sum == NegatableType(12345)) ? "!" : "");
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / double(x.size());
+  }
+
+  template<typename NegatableType, typename FunctionType, typename LutFunctionType>
+  void compare(const std::string& name, const std::vector<NegatableType>& x, FunctionType function, LutFunctionType lut_function)
+  {
+    // Evaluate the table-based function once in order to initialize its table.
+    static_cast<void>(lut_function(x.front()));
+
+    // Take the fastest of several runs in order to reduce timing noise.
+    double t_cmath = measure_nanoseconds_per_call(x, function);
+    double t_lut   = measure_nanoseconds_per_call(x, lut_function);
+
+    for(int run = 1; run < 5; ++run)
+    {
+      t_cmath = (std::min)(t_cmath, measure_nanoseconds_per_call(x, function));
+      t_lut   = (std::min)(t_lut,   measure_nanoseconds_per_call(x, lut_function));
+    }
+
+    std::cout << std::setw(6) << name
+              << ": cmath " << std::setw(8) << t_cmath << " ns"
+              << ", lut "   << std::setw(8) << t_lut   << " ns"
+              << std::endl;
+  }
+
+  template<typename NegatableType>
+  void benchmark(const char* type_name)
+  {
+    // Use arguments in the interval (0, 4], which is valid for all of the functions.
+    std::vector<NegatableType> x;
+
+    for(int i = 1; i <= 100000; ++i)
+    {
+      x.push_back(NegatableType(i % 4000 + 1) / 1000);
+    }
+
+    std::cout << type_name << std::endl;
+
+    compare("sin",  x, [](const NegatableType& u) { return sin (u); }, [](const NegatableType& u) { return boost::fixed_point::lut::sin (u); });
+    compare("cos",  x, [](const NegatableType& u) { return cos (u); }, [](const NegatableType& u) { return boost::fixed_point::lut::cos (u); });
+    compare("exp",  x, [](const NegatableType& u) { return exp (u); }, [](const NegatableType& u) { return boost::fixed_point::lut::exp (u); });
+    compare("log",  x, [](const NegatableType& u) { return log (u); }, [](const NegatableType& u) { return boost::fixed_point::lut::log (u); });
+    compare("sqrt", x, [](const NegatableType& u) { return sqrt(u); }, [](const NegatableType& u) { return boost::fixed_point::lut::sqrt(u); });
+    compare("atan", x, [](const NegatableType& u) { return atan(u); }, [](const NegatableType& u) { return boost::fixed_point::lut::atan(u); });
+  }
+}
+
+int main()
+{
+  std::cout << std::fixed << std::setprecision(1);
+
+  // The 16-bit type uses the tier for up to 11 fractional bits,
+  // and the 32-bit type uses the tier for up to 24 fractional bits.
+  local::benchmark<boost::fixed_point::negatable<4, -11>>("negatable<4, -11>");
+  local::benchmark<boost::fixed_point::negatable<7, -24>>("negatable<7, -24>");
+}
@@ -0,0 +1,91 @@
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Copyright Christopher Kormanyos 2016.
+
+// This file also includes Doxygen-style documentation about the function of the code.
+// See http://www.doxygen.org for details.
+
+//! \file
+
+//! \brief Example program measuring the latency of sin(negatable) and cos(negatable)
+//! for resolutions above 24 bits, over the full range of the argument.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/fixed_point/fixed_point.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  double measure_nanoseconds_per_call(const std::vector<NegatableType>& x, const bool use_sin)
+  {
+    double best = 0.0;
+
+    // Take the fastest of several runs in order to reduce timing noise.
+    for(int run = 0; run < 3; ++run)
+    {
+      NegatableType sum(0);
+
+      const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+      for(std::size_t i = 0U; i < x.size(); ++i)
+      {
+        sum += (use_sin ? sin(x[i]) : cos(x[i]));
+      }
+
+      const std::chrono::high_resolution_clock::time_point stop = std::chrono::high_resolution_clock::now();
+
+      // Print the sum in order to keep the calculations from being optimized away.
+      std::cout << ((sum == NegatableType(12345)) ? "!" : "");
+
+      const double t = std::chrono::duration<double, std::nano>(stop - start).count() / double(x.size());
+
+      best = ((run == 0) ? t : (std::min)(best, t));
+    }
+
+    return best;
+  }
+
+  template<typename NegatableType>
+  void benchmark(const char* type_name, const std::size_t count)
+  {
+    std::cout << type_name << std::endl;
+
+    // Measure the latency in intervals of the argument covering the full range.
+    const double limits[] = { 0.0, 0.7, 1.5, 3.1, 6.2, 100.0, std::ldexp(1.0, NegatableType::range) - 1.0 };
+
+    for(std::size_t j = 1U; j < sizeof(limits) / sizeof(limits[0U]); ++j)
+    {
+      std::vector<NegatableType> x;
+
+      for(std::size_t i = 0U; i < count; ++i)
+      {
+        const double u = limits[j - 1U] + ((limits[j] - limits[j - 1U]) * (double(i) + 0.5)) / double(count);
+
+        x.push_back(NegatableType((((i % 2U) == 0U) ? u : -u)));
+      }
+
+      std::cout << "  |x| in [" << std::setw(7) << limits[j - 1U] << ", " << std::setw(7) << limits[j] << "): "
+                << "sin " << std::setw(8) << measure_nanoseconds_per_call(x, true)  << " ns, "
+                << "cos " << std::setw(8) << measure_nanoseconds_per_call(x, false) << " ns"
+                << std::endl;
+    }
+  }
+}
+
+int main()
+{
+  std::cout << std::fixed << std::setprecision(1);
+
+  local::benchmark<boost::fixed_point::negatable<10,  -53>>("negatable<10, -53>",  2000U);
+  local::benchmark<boost::fixed_point::negatable<12, -115>>("negatable<12, -115>",  200U);
+}
@@ -0,0 +1,149 @@
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Copyright Christopher Kormanyos 2016.
+
+// This file also includes Doxygen-style documentation about the function of the code.
+// See http://www.doxygen.org for details.
+
+//! \file
+
+//! \brief Example program reporting the latency of asin(negatable), acos(negatable)
+//! and atan(negatable) for very wide fractional resolutions. The kernel of atan
+//! with argument halving is compared with the Newton iteration on sin and cos,
+//! and asin is compared with its former hypergeometric series. Both the mean
+//! and the maximum latency per call are printed, since the latency of the series
+//! grows without bound as the argument approaches 1.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <boost/fixed_point/fixed_point.hpp>
+
+namespace local
+{
+  struct latency
+  {
+    double mean;
+    double maximum;
+  };
+
+  template<typename NegatableType, typename FunctionType>
+  latency measure_microseconds_per_call(const std::vector<NegatableType>& x, FunctionType function)
+  {
+    latency result = { 0.0, 0.0 };
+
+    NegatableType sum(0);
+
+    // Take the fastest of several runs of each argument in order to reduce timing noise.
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      double best = 0.0;
+
+      for(int run = 0; run < 3; ++run)
+      {
+        const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+        sum += function(x[i]);
+
+        const std::chrono::high_resolution_clock::time_point stop = std::chrono::high_resolution_clock::now();
+
+        const double t = std::chrono::duration<double, std::micro>(stop - start).count();
+
+        best = ((run == 0) ? t : (std::min)(best, t));
+      }
+
+      result.mean   += best;
+      result.maximum = (std::max)(result.maximum, best);
+    }
+
+    // Print the sum in order to keep the calculations from being optimized away.
+    std::cout << ((sum == NegatableType(12345)) ? "!" : "");
+
+    result.mean /= double(x.size());
+
+    return result;
+  }
+
+  template<typename NegatableType>
+  NegatableType atan_newton(const NegatableType& x) { return boost::fixed_point::detail::atan_wide_series(x, std::false_type()); }
+
+  template<typename NegatableType>
+  NegatableType atan_halving(const NegatableType& x) { return boost::fixed_point::detail::atan_wide_series(x, std::true_type()); }
+
+  // The former implementation of asin with the hypergeometric series 2F1.
+  template<typename NegatableType>
+  NegatableType asin_series(const NegatableType& x)
+  {
+    const NegatableType one_half     = ldexp(NegatableType(1U), -1);
+    const NegatableType three_halves = ldexp(NegatableType(3U), -1);
+
+    if(x < one_half)
+    {
+      return x * boost::fixed_point::detail::hypergeometric_2f1(one_half, one_half, three_halves, (x * x));
+    }
+    else
+    {
+      const NegatableType delta = (1 - x);
+
+      return   boost::fixed_point::negatable_constants<NegatableType>::pi_half()
+             - (  sqrt(delta * 2)
+                * boost::fixed_point::detail::hypergeometric_2f1(one_half, one_half, three_halves, delta / 2));
+    }
+  }
+
+  template<typename NegatableType> NegatableType asin_function(const NegatableType& x) { return asin(x); }
+  template<typename NegatableType> NegatableType acos_function(const NegatableType& x) { return acos(x); }
+  template<typename NegatableType> NegatableType atan_function(const NegatableType& x) { return atan(x); }
+
+  void print(const char* name, const latency& t)
+  {
+    std::cout << name << std::setw(8) << t.mean << " / " << std::setw(8) << t.maximum << " us, ";
+  }
+
+  template<const int FractionalResolution>
+  void benchmark(const std::size_t count)
+  {
+    typedef boost::fixed_point::negatable<8, FractionalResolution> local_negatable_type;
+
+    // The arguments 0 < x < 1 approach 1 more and more closely.
+    std::vector<local_negatable_type> x;
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      x.push_back(local_negatable_type(int(i) + 1) / int(count + 1U));
+    }
+
+    x.push_back(1 - ldexp(local_negatable_type(1U), -16));
+    x.push_back(1 - ldexp(local_negatable_type(1U), -(-FractionalResolution / 2)));
+
+    std::cout << "negatable<8, " << std::setw(5) << FractionalResolution << "> mean / max: ";
+
+    print("atan Newton ",  measure_microseconds_per_call(x, atan_newton  <local_negatable_type>));
+    print("atan halving ", measure_microseconds_per_call(x, atan_halving <local_negatable_type>));
+    print("asin series ",  measure_microseconds_per_call(x, asin_series  <local_negatable_type>));
+    print("asin ",         measure_microseconds_per_call(x, asin_function<local_negatable_type>));
+    print("acos ",         measure_microseconds_per_call(x, acos_function<local_negatable_type>));
+    print("atan ",         measure_microseconds_per_call(x, atan_function<local_negatable_type>));
+
+    std::cout << std::endl;
+  }
+}
+
+int main()
+{
+  std::cout << std::fixed << std::setprecision(1);
+
+  local::benchmark<  -80>(50U);
+  local::benchmark< -128>(50U);
+  local::benchmark< -256>(20U);
+  local::benchmark< -512>(10U);
+  local::benchmark<-1024>(10U);
+}
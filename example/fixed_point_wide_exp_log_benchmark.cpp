@@ -0,0 +1,113 @@
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Copyright Christopher Kormanyos 2016.
+
+// This file also includes Doxygen-style documentation about the function of the code.
+// See http://www.doxygen.org for details.
+
+//! \file
+
+//! \brief Example program comparing the latency of the kernels of exp(negatable)
+//! and log(negatable) for very wide fractional resolutions. The Taylor series
+//! of exp is compared with binary splitting, and the Newton iteration of log
+//! is compared with the arithmetic-geometric mean (AGM). The crossover points
+//! are used for the thresholds in detail::wide_exp_log_tier.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <boost/fixed_point/fixed_point.hpp>
+
+namespace local
+{
+  template<typename NegatableType, typename KernelType>
+  double measure_microseconds_per_call(const std::vector<NegatableType>& x, KernelType kernel)
+  {
+    double best = 0.0;
+
+    // Take the fastest of several runs in order to reduce timing noise.
+    for(int run = 0; run < 3; ++run)
+    {
+      NegatableType sum(0);
+
+      const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+      for(std::size_t i = 0U; i < x.size(); ++i)
+      {
+        sum += kernel(x[i]);
+      }
+
+      const std::chrono::high_resolution_clock::time_point stop = std::chrono::high_resolution_clock::now();
+
+      // Print the sum in order to keep the calculations from being optimized away.
+      std::cout << ((sum == NegatableType(12345)) ? "!" : "");
+
+      const double t = std::chrono::duration<double, std::micro>(stop - start).count() / double(x.size());
+
+      best = ((run == 0) ? t : (std::min)(best, t));
+    }
+
+    return best;
+  }
+
+  template<typename NegatableType>
+  NegatableType exp_series(const NegatableType& x) { return boost::fixed_point::detail::exp_wide_series(x, std::false_type()); }
+
+  template<typename NegatableType>
+  NegatableType exp_binary_splitting(const NegatableType& x) { return boost::fixed_point::detail::exp_wide_series(x, std::true_type()); }
+
+  template<typename NegatableType>
+  NegatableType log_newton(const NegatableType& x) { return boost::fixed_point::detail::log_wide_iteration(x, std::false_type()); }
+
+  template<typename NegatableType>
+  NegatableType log_agm(const NegatableType& x) { return boost::fixed_point::detail::log_wide_iteration(x, std::true_type()); }
+
+  template<const int FractionalResolution>
+  void benchmark(const std::size_t count)
+  {
+    typedef boost::fixed_point::negatable<8, FractionalResolution> local_negatable_type;
+
+    // The kernel of exp is called with -log(2)/2 <= x <= +log(2)/2.
+    // The kernel of log is called with 1 < x <= 2.
+    std::vector<local_negatable_type> x_exp;
+    std::vector<local_negatable_type> x_log;
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      const local_negatable_type u = local_negatable_type(int(i) + 1) / int(count + 1U);
+
+      x_exp.push_back(u * boost::fixed_point::negatable_constants<local_negatable_type>::ln_two() - boost::fixed_point::negatable_constants<local_negatable_type>::ln_two() / 2);
+      x_log.push_back(1 + u);
+    }
+
+    std::cout << "negatable<8, " << std::setw(5) << FractionalResolution << ">: "
+              << "exp series "           << std::setw(8) << measure_microseconds_per_call(x_exp, exp_series<local_negatable_type>)           << " us, "
+              << "exp binary splitting " << std::setw(8) << measure_microseconds_per_call(x_exp, exp_binary_splitting<local_negatable_type>) << " us, "
+              << "log Newton "           << std::setw(8) << measure_microseconds_per_call(x_log, log_newton<local_negatable_type>)           << " us, "
+              << "log AGM "              << std::setw(8) << measure_microseconds_per_call(x_log, log_agm<local_negatable_type>)              << " us"
+              << std::endl;
+  }
+}
+
+int main()
+{
+  std::cout << std::fixed << std::setprecision(1);
+
+  local::benchmark<  -64>(200U);
+  local::benchmark< -128>(100U);
+  local::benchmark< -192>(100U);
+  local::benchmark< -256>( 50U);
+  local::benchmark< -320>( 50U);
+  local::benchmark< -384>( 50U);
+  local::benchmark< -512>( 20U);
+  local::benchmark< -768>( 10U);
+  local::benchmark<-1024>( 10U);
+}
@@ -441,6 +441,28 @@
     }
   }
 
+  // Make a template specialization of msb_helper() for std::uint64_t.
+  template<>
+  std::uint_fast16_t msb_helper(std::uint64_t& u,
+                                std::uint64_t&,
+                                const std::uint_fast16_t)
+  {
+    std::uint_fast8_t r(0);
+    std::uint_fast8_t s;
+
+    // Use O(log2[N]) binary-halving in an unrolled sequence to find the msb.
+    // The conditions are converted to shift counts, avoiding branches
+    // that can not be predicted for arbitrary arguments.
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0xFFFFFFFF00000000)) != UINT64_C(0)) << 5); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0x00000000FFFF0000)) != UINT64_C(0)) << 4); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0x000000000000FF00)) != UINT64_C(0)) << 3); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0x00000000000000F0)) != UINT64_C(0)) << 2); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0x000000000000000C)) != UINT64_C(0)) << 1); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT64_C(0x0000000000000002)) != UINT64_C(0)) << 0); u >>= s; r |= s;
+
+    return std::uint_fast16_t(r);
+  }
+
   // Make a template specialization of msb_helper() for std::uint32_t.
   template<>
   std::uint_fast16_t msb_helper(std::uint32_t& u,
@@ -448,13 +470,14 @@
                                 const std::uint_fast16_t)
   {
     std::uint_fast8_t r(0);
+    std::uint_fast8_t s;
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((u & UINT32_C(0xFFFF0000)) != UINT32_C(0)) { u >>= 16; r |= UINT8_C(16); }
-    if((u & UINT32_C(0x0000FF00)) != UINT32_C(0)) { u >>=  8; r |= UINT8_C( 8); }
-    if((u & UINT32_C(0x000000F0)) != UINT32_C(0)) { u >>=  4; r |= UINT8_C( 4); }
-    if((u & UINT32_C(0x0000000C)) != UINT32_C(0)) { u >>=  2; r |= UINT8_C( 2); }
-    if((u & UINT32_C(0x00000002)) != UINT32_C(0)) { u >>=  1; r |= UINT8_C( 1); }
+    // Use O(log2[N]) binary-halving in an unrolled sequence to find the msb.
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT32_C(0xFFFF0000)) != UINT32_C(0)) << 4); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT32_C(0x0000FF00)) != UINT32_C(0)) << 3); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT32_C(0x000000F0)) != UINT32_C(0)) << 2); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT32_C(0x0000000C)) != UINT32_C(0)) << 1); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT32_C(0x00000002)) != UINT32_C(0)) << 0); u >>= s; r |= s;
 
     return std::uint_fast16_t(r);
   }
@@ -466,12 +489,13 @@
                                 const std::uint_fast16_t)
   {
     std::uint_fast8_t r(0);
+    std::uint_fast8_t s;
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((u & UINT16_C(0xFF00)) != UINT16_C(0)) { u >>= 8; r |= UINT8_C(8); }
-    if((u & UINT16_C(0x00F0)) != UINT16_C(0)) { u >>= 4; r |= UINT8_C(4); }
-    if((u & UINT16_C(0x000C)) != UINT16_C(0)) { u >>= 2; r |= UINT8_C(2); }
-    if((u & UINT16_C(0x0002)) != UINT16_C(0)) { u >>= 1; r |= UINT8_C(1); }
+    // Use O(log2[N]) binary-halving in an unrolled sequence to find the msb.
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT16_C(0xFF00)) != UINT16_C(0)) << 3); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT16_C(0x00F0)) != UINT16_C(0)) << 2); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT16_C(0x000C)) != UINT16_C(0)) << 1); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT16_C(0x0002)) != UINT16_C(0)) << 0); u >>= s; r |= s;
 
     return std::uint_fast16_t(r);
   }
@@ -483,15 +507,133 @@
                                 const std::uint_fast16_t)
   {
     std::uint_fast8_t r(0);
+    std::uint_fast8_t s;
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((u & UINT8_C(0xF0)) != UINT8_C(0)) { u >>= 4; r |= UINT8_C(4); }
-    if((u & UINT8_C(0x0C)) != UINT8_C(0)) { u >>= 2; r |= UINT8_C(2); }
-    if((u & UINT8_C(0x02)) != UINT8_C(0)) { u >>= 1; r |= UINT8_C(1); }
+    // Use O(log2[N]) binary-halving in an unrolled sequence to find the msb.
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT8_C(0xF0)) != UINT8_C(0)) << 2); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT8_C(0x0C)) != UINT8_C(0)) << 1); u >>= s; r |= s;
+    s = std::uint_fast8_t(std::uint_fast8_t((u & UINT8_C(0x02)) != UINT8_C(0)) << 0); u >>= s; r |= s;
 
     return std::uint_fast16_t(r);
   }
 
+  // Compute the number of significant bits in the compile-time constant N.
+  template<const std::uintmax_t N>
+  struct constant_bit_count
+  {
+    static BOOST_CONSTEXPR_OR_CONST int value = 1 + constant_bit_count<N / 2U>::value;
+  };
+
+  template<>
+  struct constant_bit_count<0U>
+  {
+    static BOOST_CONSTEXPR_OR_CONST int value = 0;
+  };
+
+  // Split the compile-time integral constant N into its sign and its magnitude.
+  template<typename IntegralType, const IntegralType N>
+  struct constant_magnitude
+  {
+    static BOOST_CONSTEXPR_OR_CONST bool is_neg = (std::is_signed<IntegralType>::value && (N < IntegralType(0)));
+
+    static BOOST_CONSTEXPR_OR_CONST std::uintmax_t value = (is_neg ? std::uintmax_t(std::uintmax_t(0U) - std::uintmax_t(N))
+                                                                    : std::uintmax_t(N));
+
+    static BOOST_CONSTEXPR_OR_CONST bool is_power_of_two = ((value != 0U) && ((value & (value - 1U)) == 0U));
+
+    static BOOST_CONSTEXPR_OR_CONST int power_of_two_shift = constant_bit_count<value>::value - 1;
+  };
+
+  // Test a candidate shift p for the reciprocal multiplication by the
+  // compile-time divisor d. The multiplier is m = ceil(2^p / d).
+  // If (m * d) - 2^p <= 2^(p - NumeratorDigits), then floor(u / d)
+  // equals (u * m) >> p for all u < 2^NumeratorDigits. This is the
+  // round-up method described by T. Granlund and P. L. Montgomery in
+  // "Division by Invariant Integers using Multiplication" (1994).
+  template<const int NumeratorDigits, const std::uintmax_t Divisor, const int Shift>
+  struct constant_divide_candidate
+  {
+    static BOOST_CONSTEXPR_OR_CONST bool is_in_range = (Shift < std::numeric_limits<std::uintmax_t>::digits - 1);
+
+    static BOOST_CONSTEXPR_OR_CONST std::uintmax_t two_pow_shift = std::uintmax_t(std::uintmax_t(1U) << (is_in_range ? Shift : 0));
+
+    static BOOST_CONSTEXPR_OR_CONST std::uintmax_t multiplier = ((two_pow_shift / Divisor) + (((two_pow_shift % Divisor) != 0U) ? 1U : 0U));
+
+    static BOOST_CONSTEXPR_OR_CONST bool is_valid =
+      (is_in_range && (((multiplier * Divisor) - two_pow_shift) <= std::uintmax_t(std::uintmax_t(1U) << (is_in_range ? (Shift - NumeratorDigits) : 0))));
+  };
+
+  // Search for the smallest valid shift (and thereby the narrowest multiplier).
+  template<const int NumeratorDigits, const std::uintmax_t Divisor, const int Shift,
+           const bool IsDone = (   constant_divide_candidate<NumeratorDigits, Divisor, Shift>::is_valid
+                                || (!constant_divide_candidate<NumeratorDigits, Divisor, Shift>::is_in_range))>
+  struct constant_divide_search
+  {
+    static BOOST_CONSTEXPR_OR_CONST bool           is_valid   = constant_divide_search<NumeratorDigits, Divisor, Shift + 1>::is_valid;
+    static BOOST_CONSTEXPR_OR_CONST std::uintmax_t multiplier = constant_divide_search<NumeratorDigits, Divisor, Shift + 1>::multiplier;
+    static BOOST_CONSTEXPR_OR_CONST int            shift      = constant_divide_search<NumeratorDigits, Divisor, Shift + 1>::shift;
+  };
+
+  template<const int NumeratorDigits, const std::uintmax_t Divisor, const int Shift>
+  struct constant_divide_search<NumeratorDigits, Divisor, Shift, true>
+  {
+    static BOOST_CONSTEXPR_OR_CONST bool           is_valid   = constant_divide_candidate<NumeratorDigits, Divisor, Shift>::is_valid;
+    static BOOST_CONSTEXPR_OR_CONST std::uintmax_t multiplier = constant_divide_candidate<NumeratorDigits, Divisor, Shift>::multiplier;
+    static BOOST_CONSTEXPR_OR_CONST int            shift      = Shift;
+  };
+
+  // Divide an unsigned integral value by a compile-time constant divisor.
+  // The quotient is always identical to the truncated quotient (u / Divisor).
+  // Powers of two use a right shift. Other divisors use a multiplication
+  // with a compile-time reciprocal followed by a right shift, provided that
+  // the product fits in the built-in UnsignedProductType. Otherwise
+  // a run-time division is used.
+  template<typename UnsignedSmallType, typename UnsignedProductType, const std::uintmax_t Divisor>
+  struct constant_divide_helper
+  {
+  private:
+    static_assert(Divisor != 0U, "Error: Division by a compile-time constant of zero.");
+
+    static BOOST_CONSTEXPR_OR_CONST int numerator_digits = std::numeric_limits<UnsignedSmallType>::digits;
+
+    typedef constant_divide_search<numerator_digits, Divisor, numerator_digits> search_type;
+
+  public:
+    static BOOST_CONSTEXPR_OR_CONST int method =
+        (constant_bit_count<Divisor>::value > numerator_digits) ? 3
+      : (((Divisor & (Divisor - 1U)) == 0U) ? 0
+      : ((   search_type::is_valid
+          && std::is_integral<UnsignedProductType>::value
+          && ((numerator_digits + constant_bit_count<search_type::multiplier>::value) <= std::numeric_limits<UnsignedProductType>::digits)) ? 1 : 2));
+
+    static UnsignedSmallType divide(const UnsignedSmallType& u)
+    {
+      return divide_with_method(u, std::integral_constant<int, method>());
+    }
+
+  private:
+    static UnsignedSmallType divide_with_method(const UnsignedSmallType& u, const std::integral_constant<int, 0>&)
+    {
+      return UnsignedSmallType(u >> (constant_bit_count<Divisor>::value - 1));
+    }
+
+    static UnsignedSmallType divide_with_method(const UnsignedSmallType& u, const std::integral_constant<int, 1>&)
+    {
+      return UnsignedSmallType((UnsignedProductType(u) * UnsignedProductType(search_type::multiplier)) >> search_type::shift);
+    }
+
+    static UnsignedSmallType divide_with_method(const UnsignedSmallType& u, const std::integral_constant<int, 2>&)
+    {
+      return UnsignedSmallType(u / UnsignedSmallType(Divisor));
+    }
+
+    static UnsignedSmallType divide_with_method(const UnsignedSmallType&, const std::integral_constant<int, 3>&)
+    {
+      // The divisor exceeds every possible numerator.
+      return UnsignedSmallType(0U);
+    }
+  };
+
   template<typename ArithmeticType>
   ArithmeticType power_of_two_helper(int p2)
   {
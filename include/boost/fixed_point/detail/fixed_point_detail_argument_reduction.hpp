@@ -0,0 +1,376 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_argument_reduction.hpp implements a reduction
+// of trigonometric arguments modulo pi/2 in the style of Payne and Hanek.
+// The representation of the argument is multiplied exactly with a
+// multi-word integer holding the binary digits of 2/pi, whereby only
+// the bits of the product that contribute to the quadrant and to the
+// reduced argument are kept. The multiplications run on little-endian
+// arrays of 32-bit limbs, independent of the width of the fixed-point type.
+
+#ifndef FIXED_POINT_DETAIL_ARGUMENT_REDUCTION_2016_11_10_HPP_
+  #define FIXED_POINT_DETAIL_ARGUMENT_REDUCTION_2016_11_10_HPP_
+
+  #include <array>
+  #include <cmath>
+  #include <cstddef>
+  #include <cstdint>
+  #include <type_traits>
+  #include <vector>
+
+  #include <boost/config.hpp>
+  #include <boost/fixed_point/detail/fixed_point_detail_constants.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  // Return 32 bits of a table of fractional words, beginning with the bit
+  // having the place value 2^-(first_bit + 1). Bits preceding the table
+  // (for negative first_bit) and bits beyond the end of the table are zero.
+  inline std::uint32_t fraction_words_get32(const std::uint32_t* words,
+                                            const int word_count,
+                                            const int first_bit)
+  {
+    const int bit_offset  = (((first_bit % 32) + 32) % 32);
+    const int word_offset = ((first_bit - bit_offset) / 32);
+
+    const std::uint64_t hi = (((word_offset     >= 0) && (word_offset     < word_count)) ? words[word_offset]     : UINT32_C(0));
+    const std::uint64_t lo = (((word_offset + 1 >= 0) && (word_offset + 1 < word_count)) ? words[word_offset + 1] : UINT32_C(0));
+
+    return static_cast<std::uint32_t>(((hi << 32) | lo) >> (32 - bit_offset));
+  }
+
+  // Load floor(c * 2^bit_count) into little-endian limbs, where c is
+  // the fractional constant given by the table of fractional words.
+  template<const std::size_t LimbCount>
+  void fraction_words_to_limbs(std::array<std::uint32_t, LimbCount>& limbs,
+                               const std::uint32_t* words,
+                               const int word_count,
+                               const int bit_count)
+  {
+    for(std::size_t i = 0U; i < LimbCount; ++i)
+    {
+      limbs[i] = fraction_words_get32(words, word_count, bit_count - int(32U * (i + 1U)));
+    }
+  }
+
+  // Compute w = (u * v) modulo 2^(32 * WCount) with little-endian limbs.
+  template<const std::size_t WCount, const std::size_t UCount, const std::size_t VCount>
+  void limbs_multiply(std::array<std::uint32_t, WCount>& w,
+                      const std::array<std::uint32_t, UCount>& u,
+                      const std::array<std::uint32_t, VCount>& v)
+  {
+    w.fill(UINT32_C(0));
+
+    for(std::size_t i = 0U; (i < UCount) && (i < WCount); ++i)
+    {
+      std::uint64_t carry = UINT64_C(0);
+
+      std::size_t j = 0U;
+
+      for( ; (j < VCount) && ((i + j) < WCount); ++j)
+      {
+        const std::uint64_t t = (std::uint64_t(u[i]) * v[j]) + w[i + j] + carry;
+
+        w[i + j] = static_cast<std::uint32_t>(t);
+        carry    = (t >> 32);
+      }
+
+      if((i + j) < WCount)
+      {
+        w[i + j] = static_cast<std::uint32_t>(carry);
+      }
+    }
+  }
+
+  // Extract bit_count bits from little-endian limbs,
+  // beginning at the bit with index first_bit.
+  template<const std::size_t ResultCount, const std::size_t Count>
+  void limbs_extract_bits(std::array<std::uint32_t, ResultCount>& result,
+                          const std::array<std::uint32_t, Count>& a,
+                          const int first_bit,
+                          const int bit_count)
+  {
+    const std::size_t limb_offset = std::size_t(first_bit / 32);
+    const int         bit_offset  = (first_bit % 32);
+
+    for(std::size_t i = 0U; i < ResultCount; ++i)
+    {
+      const std::size_t j = i + limb_offset;
+
+      const std::uint64_t lo = ((j      < Count) ? a[j]      : UINT32_C(0));
+      const std::uint64_t hi = ((j + 1U < Count) ? a[j + 1U] : UINT32_C(0));
+
+      result[i] = static_cast<std::uint32_t>(((hi << 32) | lo) >> bit_offset);
+
+      const int remaining_bits = bit_count - int(32U * i);
+
+      if(remaining_bits <= 0)
+      {
+        result[i] = UINT32_C(0);
+      }
+      else if(remaining_bits < 32)
+      {
+        result[i] &= static_cast<std::uint32_t>((UINT32_C(1) << remaining_bits) - 1U);
+      }
+    }
+  }
+
+  // Convert little-endian limbs to an unsigned integral type.
+  template<typename UnsignedIntegralType, const std::size_t Count>
+  UnsignedIntegralType limbs_to_unsigned(const std::array<std::uint32_t, Count>& a)
+  {
+    UnsignedIntegralType u(0U);
+
+    for(std::size_t i = Count; i > 0U; --i)
+    {
+      // Shift in two steps, since the shift width may equal the width of u.
+      u = UnsignedIntegralType(UnsignedIntegralType(UnsignedIntegralType(u << 16) << 16) | a[i - 1U]);
+    }
+
+    return u;
+  }
+
+  template<const std::size_t Count>
+  bool limbs_test_bit(const std::array<std::uint32_t, Count>& a, const int bit)
+  {
+    return (((a[std::size_t(bit / 32)] >> (bit % 32)) & 1U) != 0U);
+  }
+
+  // Provide the fractional words of pi/2 and 2/pi with at least BitCount bits.
+  // Up to the length of the tables, these are taken from the tables. Beyond that,
+  // they are computed once at runtime with a sufficiently wide floating-point type.
+  template<const int BitCount,
+           typename EnableType = void>
+  struct pi_fraction_words_helper
+  {
+    BOOST_STATIC_CONSTEXPR int word_count = ((BitCount + 31) / 32);
+
+    static const std::uint32_t* pi_half_words()
+    {
+      static const std::vector<std::uint32_t> the_words = make_words(false);
+
+      return the_words.data();
+    }
+
+    static const std::uint32_t* two_over_pi_words()
+    {
+      static const std::vector<std::uint32_t> the_words = make_words(true);
+
+      return the_words.data();
+    }
+
+  private:
+    typedef typename float_type_helper<std::uint32_t(BitCount + 32)>::exact_float_type float_type;
+
+    static std::vector<std::uint32_t> make_words(const bool is_two_over_pi)
+    {
+      using std::floor;
+      using std::ldexp;
+
+      const float_type pi = calculate_pi<float_type>();
+
+      float_type c = (is_two_over_pi ? float_type(float_type(2U) / pi) : float_type(pi / 2U));
+
+      c -= floor(c);
+
+      std::vector<std::uint32_t> words(std::size_t(word_count), UINT32_C(0));
+
+      for(std::size_t i = 0U; i < words.size(); ++i)
+      {
+        c = ldexp(c, 32);
+
+        const float_type c_floor = floor(c);
+
+        words[i] = static_cast<std::uint32_t>(c_floor);
+
+        c -= c_floor;
+      }
+
+      return words;
+    }
+  };
+
+  template<const int BitCount>
+  struct pi_fraction_words_helper<BitCount,
+                                  typename std::enable_if<(BitCount <= (pi_fraction_table_word_count * 32))>::type>
+  {
+    BOOST_STATIC_CONSTEXPR int word_count = pi_fraction_table_word_count;
+
+    static const std::uint32_t* pi_half_words    () { return pi_half_fraction_words(); }
+    static const std::uint32_t* two_over_pi_words() { return two_over_pi_fraction_words(); }
+  };
+
+  /*! Reduce the argument x >= 0 of a fixed-point type according to
+      x = r + (n * pi/2), with -pi/4 <= r <= +pi/4, and provide q = (n mod 4).\n
+      The representation of x is an integer X having range + radix_split bits.
+      The product y = x * (2/pi) is formed exactly as X * W, where W holds
+      (range + radix_split + guard_bits) bits of 2/pi. Only the bits of
+      the product below 4 are kept, since the remaining ones contribute
+      multiples of 4 to n. The fractional part f of y is then rounded
+      to the nearest integer and r is obtained from (f * pi/2).
+      The cost amounts to a few multiplications of 32-bit limbs.
+  */
+  template<typename NegatableType>
+  struct argument_reduction_pi_half
+  {
+  public:
+    static std::uint_fast8_t reduce(const NegatableType& x, NegatableType& r)
+    {
+      unsigned_small_type u(x.crepresentation());
+
+      // Arguments up to pi/4 need no reduction.
+      if(u <= unsigned_small_type(negatable_constants<NegatableType>::pi_quarter().crepresentation()))
+      {
+        r = x;
+
+        return UINT8_C(0);
+      }
+
+      // Load the representation of x into limbs.
+      std::array<std::uint32_t, x_limb_count> x_limbs;
+
+      for(std::size_t i = 0U; i < x_limb_count; ++i)
+      {
+        x_limbs[i] = static_cast<std::uint32_t>(u & UINT32_C(0xFFFFFFFF));
+
+        u = unsigned_small_type(unsigned_small_type(u >> 16) >> 16);
+      }
+
+      // Compute y = x * (2/pi) modulo 4.
+      std::array<std::uint32_t, p_limb_count> p_limbs;
+
+      limbs_multiply(p_limbs, x_limbs, two_over_pi_limbs());
+
+      // Extract y with y_fraction_bits fractional bits and 2 integer bits.
+      std::array<std::uint32_t, y_limb_count> y_limbs;
+
+      limbs_extract_bits(y_limbs, p_limbs, range + radix_split, y_fraction_bits + 2);
+
+      std::uint_fast8_t q =
+        static_cast<std::uint_fast8_t>(  (limbs_test_bit(y_limbs, y_fraction_bits + 1) ? 2U : 0U)
+                                       + (limbs_test_bit(y_limbs, y_fraction_bits    ) ? 1U : 0U));
+
+      // The fractional part of y is f. Round it to the range -1/2 <= f <= +1/2.
+      std::array<std::uint32_t, f_limb_count> f_limbs;
+
+      limbs_extract_bits(f_limbs, y_limbs, 0, y_fraction_bits);
+
+      const bool f_is_neg = limbs_test_bit(f_limbs, y_fraction_bits - 1);
+
+      if(f_is_neg)
+      {
+        // Here, f >= 1/2. Use (f - 1) instead, having the magnitude
+        // (1 - f), and increment the quadrant.
+        std::uint64_t carry = UINT64_C(1);
+
+        for(std::size_t i = 0U; i < f_limb_count; ++i)
+        {
+          const std::uint64_t t = std::uint64_t(static_cast<std::uint32_t>(~f_limbs[i])) + carry;
+
+          f_limbs[i] = static_cast<std::uint32_t>(t);
+          carry      = (t >> 32);
+        }
+
+        limbs_extract_bits(f_limbs, f_limbs, 0, y_fraction_bits);
+
+        q = static_cast<std::uint_fast8_t>((q + 1U) % 4U);
+      }
+
+      // Compute |r| = |f| * pi/2 and scale it to the representation.
+      std::array<std::uint32_t, f_limb_count + c_limb_count> rp_limbs;
+
+      limbs_multiply(rp_limbs, f_limbs, pi_half_limbs());
+
+      std::array<std::uint32_t, r_limb_count> r_limbs;
+
+      limbs_extract_bits(r_limbs, rp_limbs, radix_split + (2 * guard_bits), radix_split);
+
+      unsigned_small_type r_magnitude = limbs_to_unsigned<unsigned_small_type>(r_limbs);
+
+      // Round to nearest.
+      if(limbs_test_bit(rp_limbs, radix_split + (2 * guard_bits) - 1))
+      {
+        ++r_magnitude;
+      }
+
+      r = ((!f_is_neg) ?  NegatableType(nothing(), value_type(r_magnitude))
+                       : -NegatableType(nothing(), value_type(r_magnitude)));
+
+      return q;
+    }
+
+  private:
+    typedef typename NegatableType::value_type          value_type;
+    typedef typename NegatableType::unsigned_small_type unsigned_small_type;
+    typedef typename NegatableType::nothing             nothing;
+
+    BOOST_STATIC_CONSTEXPR int range       = NegatableType::range;
+    BOOST_STATIC_CONSTEXPR int radix_split = NegatableType::radix_split;
+    BOOST_STATIC_CONSTEXPR int guard_bits  = 8;
+
+    // The number of fractional bits of y = x * (2/pi).
+    BOOST_STATIC_CONSTEXPR int y_fraction_bits = radix_split + guard_bits;
+
+    // The number of bits of 2/pi needed for y_fraction_bits correct bits in y.
+    BOOST_STATIC_CONSTEXPR int two_over_pi_bits = range + y_fraction_bits;
+
+    // The product X * W carries (two_over_pi_bits + radix_split) fractional bits.
+    // Only its bits below (y modulo 4) are needed.
+    BOOST_STATIC_CONSTEXPR int p_bits = two_over_pi_bits + radix_split + 2;
+
+    BOOST_STATIC_CONSTEXPR std::size_t x_limb_count = std::size_t((range + radix_split + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t w_limb_count = std::size_t((two_over_pi_bits + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t p_limb_count = std::size_t((p_bits + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t y_limb_count = std::size_t((y_fraction_bits + 2 + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t f_limb_count = std::size_t((y_fraction_bits + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t c_limb_count = std::size_t((y_fraction_bits + 1 + 31) / 32);
+    BOOST_STATIC_CONSTEXPR std::size_t r_limb_count = std::size_t((radix_split + 31) / 32);
+
+    typedef pi_fraction_words_helper<two_over_pi_bits> words_helper;
+
+    // The limbs of W = floor((2/pi) * 2^two_over_pi_bits).
+    static const std::array<std::uint32_t, w_limb_count>& two_over_pi_limbs()
+    {
+      static const std::array<std::uint32_t, w_limb_count> the_limbs = make_two_over_pi_limbs();
+
+      return the_limbs;
+    }
+
+    // The limbs of floor((pi/2) * 2^y_fraction_bits).
+    static const std::array<std::uint32_t, c_limb_count>& pi_half_limbs()
+    {
+      static const std::array<std::uint32_t, c_limb_count> the_limbs = make_pi_half_limbs();
+
+      return the_limbs;
+    }
+
+    static std::array<std::uint32_t, w_limb_count> make_two_over_pi_limbs()
+    {
+      std::array<std::uint32_t, w_limb_count> limbs;
+
+      fraction_words_to_limbs(limbs, words_helper::two_over_pi_words(), words_helper::word_count, two_over_pi_bits);
+
+      return limbs;
+    }
+
+    static std::array<std::uint32_t, c_limb_count> make_pi_half_limbs()
+    {
+      std::array<std::uint32_t, c_limb_count> limbs;
+
+      fraction_words_to_limbs(limbs, words_helper::pi_half_words(), words_helper::word_count, y_fraction_bits);
+
+      // Add the integer part 1 of pi/2.
+      limbs[std::size_t(y_fraction_bits / 32)] |= static_cast<std::uint32_t>(UINT32_C(1) << (y_fraction_bits % 32));
+
+      return limbs;
+    }
+  };
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_ARGUMENT_REDUCTION_2016_11_10_HPP_
@@ -7,12 +7,15 @@
 
 // fixed_point_detail_constants.hpp implements templates
 // for computing fixed-point representations of the
-// mathematical constants sqrt(2), pi, log(2) and e.
+// mathematical constants sqrt(2), pi, log(2) and e,
+// as well as tables of the binary digits of pi/2, 2/pi,
+// e, log(2), sqrt(2), log(10), 1/log(2), 1/log(10) and sqrt(pi).
 
 #ifndef FIXED_POINT_DETAIL_CONSTANTS_2015_08_16_HPP_
   #define FIXED_POINT_DETAIL_CONSTANTS_2015_08_16_HPP_
 
   #include <cmath>
+  #include <cstdint>
   #include <limits>
 
   #include <boost/config.hpp>
@@ -174,6 +177,268 @@
 
     return sum;
   }
+
+  // Tables of the fractional parts of pi/2 = 1.921FB544... and 2/pi = 0.A2F9836E...
+  // (in hexadecimal) with 1024 bits each. The bits are stored as 32-bit words
+  // with the most significant word first.
+  BOOST_CONSTEXPR_OR_CONST int pi_fraction_table_word_count = 32;
+
+  inline const std::uint32_t* pi_half_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0x921FB544), UINT32_C(0x42D18469), UINT32_C(0x898CC517), UINT32_C(0x01B839A2),
+      UINT32_C(0x52049C11), UINT32_C(0x14CF98E8), UINT32_C(0x04177D4C), UINT32_C(0x76273644),
+      UINT32_C(0xA29410F3), UINT32_C(0x1C6809BB), UINT32_C(0xDF2A3367), UINT32_C(0x9A748636),
+      UINT32_C(0x605614DB), UINT32_C(0xE4BE286E), UINT32_C(0x9FC26ADA), UINT32_C(0xDAA3848B),
+      UINT32_C(0xC90B6AEC), UINT32_C(0xC4BCFD8D), UINT32_C(0xE89885D3), UINT32_C(0x4C6FDAD6),
+      UINT32_C(0x17FEB96D), UINT32_C(0xE80D6FDB), UINT32_C(0xDC70D7F6), UINT32_C(0xB5133F4B),
+      UINT32_C(0x5D3E4822), UINT32_C(0xF8963FCC), UINT32_C(0x9250CCA3), UINT32_C(0xD9C8B67B),
+      UINT32_C(0x8400F971), UINT32_C(0x42C77E0B), UINT32_C(0x31B4906C), UINT32_C(0x38ABA734)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* two_over_pi_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0xA2F9836E), UINT32_C(0x4E441529), UINT32_C(0xFC2757D1), UINT32_C(0xF534DDC0),
+      UINT32_C(0xDB629599), UINT32_C(0x3C439041), UINT32_C(0xFE5163AB), UINT32_C(0xDEBBC561),
+      UINT32_C(0xB7246E3A), UINT32_C(0x424DD2E0), UINT32_C(0x06492EEA), UINT32_C(0x09D1921C),
+      UINT32_C(0xFE1DEB1C), UINT32_C(0xB129A73E), UINT32_C(0xE88235F5), UINT32_C(0x2EBB4484),
+      UINT32_C(0xE99C7026), UINT32_C(0xB45F7E41), UINT32_C(0x3991D639), UINT32_C(0x835339F4),
+      UINT32_C(0x9C845F8B), UINT32_C(0xBDF9283B), UINT32_C(0x1FF897FF), UINT32_C(0xDE05980F),
+      UINT32_C(0xEF2F118B), UINT32_C(0x5A0A6D1F), UINT32_C(0x6D367ECF), UINT32_C(0x27CB09B7),
+      UINT32_C(0x4F463F66), UINT32_C(0x9E5FEA2D), UINT32_C(0x7527BAC7), UINT32_C(0xEBE5F17B)
+    };
+
+    return the_words;
+  }
+
+  // Tables of the fractional parts of e = 2.B7E15162..., log(2) = 0.B17217F7...
+  // and sqrt(2) = 1.6A09E667... with the same layout.
+  BOOST_CONSTEXPR_OR_CONST int constant_fraction_table_bits = pi_fraction_table_word_count * 32;
+
+  inline const std::uint32_t* e_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0xB7E15162), UINT32_C(0x8AED2A6A), UINT32_C(0xBF715880), UINT32_C(0x9CF4F3C7),
+      UINT32_C(0x62E7160F), UINT32_C(0x38B4DA56), UINT32_C(0xA784D904), UINT32_C(0x5190CFEF),
+      UINT32_C(0x324E7738), UINT32_C(0x926CFBE5), UINT32_C(0xF4BF8D8D), UINT32_C(0x8C31D763),
+      UINT32_C(0xDA06C80A), UINT32_C(0xBB1185EB), UINT32_C(0x4F7C7B57), UINT32_C(0x57F59584),
+      UINT32_C(0x90CFD47D), UINT32_C(0x7C19BB42), UINT32_C(0x158D9554), UINT32_C(0xF7B46BCE),
+      UINT32_C(0xD55C4D79), UINT32_C(0xFD5F24D6), UINT32_C(0x613C31C3), UINT32_C(0x839A2DDF),
+      UINT32_C(0x8A9A276B), UINT32_C(0xCFBFA1C8), UINT32_C(0x77C56284), UINT32_C(0xDAB79CD4),
+      UINT32_C(0xC2B3293D), UINT32_C(0x20E9E5EA), UINT32_C(0xF02AC60A), UINT32_C(0xCC93ED87)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* ln_two_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0xB17217F7), UINT32_C(0xD1CF79AB), UINT32_C(0xC9E3B398), UINT32_C(0x03F2F6AF),
+      UINT32_C(0x40F34326), UINT32_C(0x7298B62D), UINT32_C(0x8A0D175B), UINT32_C(0x8BAAFA2B),
+      UINT32_C(0xE7B87620), UINT32_C(0x6DEBAC98), UINT32_C(0x559552FB), UINT32_C(0x4AFA1B10),
+      UINT32_C(0xED2EAE35), UINT32_C(0xC1382144), UINT32_C(0x27573B29), UINT32_C(0x1169B825),
+      UINT32_C(0x3E96CA16), UINT32_C(0x224AE8C5), UINT32_C(0x1ACBDA11), UINT32_C(0x317C387E),
+      UINT32_C(0xB9EA9BC3), UINT32_C(0xB136603B), UINT32_C(0x256FA0EC), UINT32_C(0x7657F74B),
+      UINT32_C(0x72CE87B1), UINT32_C(0x9D6548CA), UINT32_C(0xF5DFA6BD), UINT32_C(0x38303248),
+      UINT32_C(0x655FA187), UINT32_C(0x2F20E3A2), UINT32_C(0xDA2D97C5), UINT32_C(0x0F3FD5C6)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* root_two_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0x6A09E667), UINT32_C(0xF3BCC908), UINT32_C(0xB2FB1366), UINT32_C(0xEA957D3E),
+      UINT32_C(0x3ADEC175), UINT32_C(0x12775099), UINT32_C(0xDA2F590B), UINT32_C(0x0667322A),
+      UINT32_C(0x95F90608), UINT32_C(0x75714587), UINT32_C(0x5163FCDF), UINT32_C(0xB907B672),
+      UINT32_C(0x1EE950BC), UINT32_C(0x8738F694), UINT32_C(0xF0090E6C), UINT32_C(0x7BF44ED1),
+      UINT32_C(0xA4405D0E), UINT32_C(0x855E3E9C), UINT32_C(0xA60B38C0), UINT32_C(0x237866F7),
+      UINT32_C(0x95637922), UINT32_C(0x2D108B14), UINT32_C(0x8C1578E4), UINT32_C(0x5EF89C67),
+      UINT32_C(0x8DAB5147), UINT32_C(0x176FD3B9), UINT32_C(0x9654C686), UINT32_C(0x63E7909B),
+      UINT32_C(0xEA5E241F), UINT32_C(0x06DCB05D), UINT32_C(0xD5494113), UINT32_C(0x20819495)
+    };
+
+    return the_words;
+  }
+
+  // Tables of the fractional parts of log(10) = 2.4D763776..., 1/log(2) = 1.71547652...,
+  // 1/log(10) = 0.6F2DEC54... and sqrt(pi) = 1.C5BF891B... with the same layout.
+  inline const std::uint32_t* ln_ten_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0x4D763776), UINT32_C(0xAAA2B05B), UINT32_C(0xA95B58AE), UINT32_C(0x0B4C28A3),
+      UINT32_C(0x8A3FB3E7), UINT32_C(0x6977E43A), UINT32_C(0x0F187A08), UINT32_C(0x07C0B5CA),
+      UINT32_C(0x58BC0B5E), UINT32_C(0xC6A04173), UINT32_C(0x31C32F00), UINT32_C(0xB17C35A0),
+      UINT32_C(0xB1889061), UINT32_C(0x042F8B6B), UINT32_C(0xEE3DE210), UINT32_C(0x0B945B59),
+      UINT32_C(0xE0B3E28A), UINT32_C(0x2A324479), UINT32_C(0xD96A9B0E), UINT32_C(0xC360C7EF),
+      UINT32_C(0xBD9B3AC1), UINT32_C(0x2ACF1BE9), UINT32_C(0x4586ED27), UINT32_C(0x48671EEF),
+      UINT32_C(0x299ECD6C), UINT32_C(0x8D814216), UINT32_C(0x3A4CDA35), UINT32_C(0x11E2713D),
+      UINT32_C(0x6C22C15F), UINT32_C(0x57B7883D), UINT32_C(0x1A7A963A), UINT32_C(0x4C17A607)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* inv_ln_two_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0x71547652), UINT32_C(0xB82FE177), UINT32_C(0x7D0FFDA0), UINT32_C(0xD23A7D11),
+      UINT32_C(0xD6AEF551), UINT32_C(0xBAD2B4B1), UINT32_C(0x164A2CD9), UINT32_C(0xA342648F),
+      UINT32_C(0xBC3887EE), UINT32_C(0xAA2ED9AC), UINT32_C(0x49B25EEB), UINT32_C(0x82D7C167),
+      UINT32_C(0xD52173CC), UINT32_C(0x1895213F), UINT32_C(0x897F5E06), UINT32_C(0xA7BE7366),
+      UINT32_C(0x5FC52926), UINT32_C(0x4C2FB3AB), UINT32_C(0x643687AA), UINT32_C(0xF3AB440C),
+      UINT32_C(0x16BD777E), UINT32_C(0x75050A8D), UINT32_C(0x1A39E8AF), UINT32_C(0x56C64A78),
+      UINT32_C(0x33352906), UINT32_C(0xDEB692CE), UINT32_C(0x4F199E10), UINT32_C(0x8CF39281),
+      UINT32_C(0x9CFC406B), UINT32_C(0x19ABB71E), UINT32_C(0xC25E11F7), UINT32_C(0x5C6142E6)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* inv_ln_ten_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0x6F2DEC54), UINT32_C(0x9B9438CA), UINT32_C(0x9AADD557), UINT32_C(0xD699EE19),
+      UINT32_C(0x1F71A301), UINT32_C(0x22E4D101), UINT32_C(0x1D1F96A2), UINT32_C(0x7BC7529E),
+      UINT32_C(0x3AA1277D), UINT32_C(0x0A0179F9), UINT32_C(0x4911AAC9), UINT32_C(0x6323250A),
+      UINT32_C(0x8C671DEC), UINT32_C(0xFE9C6E5E), UINT32_C(0x37D15C69), UINT32_C(0x6466D3D9),
+      UINT32_C(0xA1AB5E8C), UINT32_C(0xA46837FC), UINT32_C(0xA0039002), UINT32_C(0xC60EE26D),
+      UINT32_C(0x32C5B0F5), UINT32_C(0x216426B5), UINT32_C(0x2859B6F6), UINT32_C(0x979B9CEA),
+      UINT32_C(0xAA181095), UINT32_C(0x7346026A), UINT32_C(0x32476644), UINT32_C(0xE628FC9A),
+      UINT32_C(0x6BCA6B27), UINT32_C(0x93E4B475), UINT32_C(0xD9FF2061), UINT32_C(0x766D8FB6)
+    };
+
+    return the_words;
+  }
+
+  inline const std::uint32_t* sqrt_pi_fraction_words()
+  {
+    static const std::uint32_t the_words[pi_fraction_table_word_count] =
+    {
+      UINT32_C(0xC5BF891B), UINT32_C(0x4EF6AA79), UINT32_C(0xC3B0520D), UINT32_C(0x5DB9383F),
+      UINT32_C(0xE3921546), UINT32_C(0xF63B252D), UINT32_C(0xCA100BD3), UINT32_C(0xEA14746E),
+      UINT32_C(0xD76FFD6F), UINT32_C(0x941F1DBA), UINT32_C(0xCD8E7614), UINT32_C(0x1E0C7747),
+      UINT32_C(0x6C521446), UINT32_C(0xDDC35851), UINT32_C(0x524490C3), UINT32_C(0x4A42174D),
+      UINT32_C(0xCBAFDF10), UINT32_C(0x9D1B3ACF), UINT32_C(0xB553ADE4), UINT32_C(0x65BEA6C5),
+      UINT32_C(0x032AA8A1), UINT32_C(0x11A626E2), UINT32_C(0xC702F124), UINT32_C(0xD16FB3A9),
+      UINT32_C(0x0B8B1717), UINT32_C(0x835C4E1E), UINT32_C(0xC9C08F40), UINT32_C(0xA3DB6D81),
+      UINT32_C(0x23741CA7), UINT32_C(0x88A38E7A), UINT32_C(0x619FFB5B), UINT32_C(0xAEBF7B16)
+    };
+
+    return the_words;
+  }
+
+  // Descriptions of further constants c. The literal is c * 2^61, rounded down.
+  // The representation with bits > 61 is obtained from the integer part
+  // and the fraction words with (bits + table_shift) bits.
+  // log(10)
+  struct constant_digits_ln_ten
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x49AEC6EED554560B);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 2U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = 0;
+
+    static const std::uint32_t* fraction_words() { return ln_ten_fraction_words(); }
+  };
+
+  // 1/log(2)
+  struct constant_digits_inv_ln_two
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x2E2A8ECA5705FC2E);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 1U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = 0;
+
+    static const std::uint32_t* fraction_words() { return inv_ln_two_fraction_words(); }
+  };
+
+  // 1/log(10)
+  struct constant_digits_inv_ln_ten
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x0DE5BD8A93728719);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 0U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = 0;
+
+    static const std::uint32_t* fraction_words() { return inv_ln_ten_fraction_words(); }
+  };
+
+  // 2/pi
+  struct constant_digits_two_over_pi
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x145F306DC9C882A5);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 0U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = 0;
+
+    static const std::uint32_t* fraction_words() { return two_over_pi_fraction_words(); }
+  };
+
+  // pi/4, from the digits of pi/2
+  struct constant_digits_pi_quarter
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x1921FB54442D1846);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 1U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = -1;
+
+    static const std::uint32_t* fraction_words() { return pi_half_fraction_words(); }
+  };
+
+  // 1/pi, from the digits of 2/pi
+  struct constant_digits_inv_pi
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x0A2F9836E4E44152);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 0U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = -1;
+
+    static const std::uint32_t* fraction_words() { return two_over_pi_fraction_words(); }
+  };
+
+  // sqrt(pi)
+  struct constant_digits_sqrt_pi
+  {
+    BOOST_STATIC_CONSTEXPR std::uint64_t literal      = UINT64_C(0x38B7F12369DED54F);
+    BOOST_STATIC_CONSTEXPR std::uint32_t integer_part = 1U;
+    BOOST_STATIC_CONSTEXPR int           table_shift  = 0;
+
+    static const std::uint32_t* fraction_words() { return sqrt_pi_fraction_words(); }
+  };
+
+  // Return the constant (integer_part + 0.fraction_words) multiplied with 2^bits
+  // and rounded to nearest, for bits < constant_fraction_table_bits.
+  // The unsigned type must hold the integer part, the bits and one rounding bit.
+  template<typename UnsignedIntegralType>
+  UnsignedIntegralType constant_from_fraction_words(const std::uint32_t  integer_part,
+                                                    const std::uint32_t* fraction_words,
+                                                    const int            bits)
+  {
+    UnsignedIntegralType result(integer_part);
+
+    int remaining_bits = bits + 1;
+
+    for(int i = 0; remaining_bits > 0; ++i)
+    {
+      const int n = ((remaining_bits < 32) ? remaining_bits : 32);
+
+      result = UnsignedIntegralType(UnsignedIntegralType(result << n) | UnsignedIntegralType(fraction_words[i] >> (32 - n)));
+
+      remaining_bits -= n;
+    }
+
+    return UnsignedIntegralType(UnsignedIntegralType(result + 1U) >> 1);
+  }
+
   } } } // namespace boost::fixed_point::detail
 
 #endif // FIXED_POINT_DETAIL_CONSTANTS_2015_08_16_HPP_
@@ -0,0 +1,336 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_constants_binary_splitting.hpp computes
+// the representations of the mathematical constants pi, e, log(2),
+// sqrt(2) and others for wide fractional resolutions. It works directly
+// on unbounded multiprecision integers. The series are summed
+// with binary splitting (Chudnovsky for pi). Each constant is
+// computed once with the widest requested number of bits and
+// narrower representations are derived from it by shifting.
+
+#ifndef FIXED_POINT_DETAIL_CONSTANTS_BINARY_SPLITTING_2016_11_19_HPP_
+  #define FIXED_POINT_DETAIL_CONSTANTS_BINARY_SPLITTING_2016_11_19_HPP_
+
+  #if !defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
+
+  #include <cmath>
+  #include <cstdint>
+  #include <mutex>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  #if defined(BOOST_FIXED_POINT_ENABLE_GMP_BACKENDS)
+    typedef boost::multiprecision::mpz_int wide_integer_type;
+  #else
+    typedef boost::multiprecision::number<boost::multiprecision::cpp_int_backend<>,
+                                          boost::multiprecision::et_off> wide_integer_type;
+  #endif
+
+  inline int wide_integer_msb(const wide_integer_type& u)
+  {
+    return int(boost::multiprecision::msb(u));
+  }
+
+  // Compute the integer square root of n within a few units.
+  // The upper half of the bits is obtained recursively and
+  // one Newton step then doubles the number of correct bits.
+  inline wide_integer_type wide_integer_sqrt(const wide_integer_type& n)
+  {
+    if(n <= 0)
+    {
+      return wide_integer_type(0U);
+    }
+
+    const int bits = wide_integer_msb(n) + 1;
+
+    if(bits <= 100)
+    {
+      using std::sqrt;
+
+      return wide_integer_type(sqrt(n.convert_to<double>()));
+    }
+
+    const int shift = (bits / 2) & ~1;
+
+    const wide_integer_type r = (wide_integer_sqrt(n >> shift) << (shift / 2)) + 1U;
+
+    return (r + (n / r)) >> 1;
+  }
+
+  // Binary splitting of the series sum_k a(k) * prod_{j<=k} p(j)/q(j),
+  // summing the terms first through last - 1. The sum is T / Q,
+  // in which P and Q are the products of p(j) and q(j).
+  template<typename SeriesType>
+  void constant_binary_splitting(const std::uint32_t first,
+                                 const std::uint32_t last,
+                                 wide_integer_type& P,
+                                 wide_integer_type& Q,
+                                 wide_integer_type& T)
+  {
+    if((last - first) == 1U)
+    {
+      P = SeriesType::p(first);
+      Q = SeriesType::q(first);
+      T = SeriesType::a(first) * P;
+    }
+    else
+    {
+      const std::uint32_t middle = (first + last) / 2U;
+
+      wide_integer_type P2;
+      wide_integer_type Q2;
+      wide_integer_type T2;
+
+      constant_binary_splitting<SeriesType>(first,  middle, P,  Q,  T);
+      constant_binary_splitting<SeriesType>(middle, last,   P2, Q2, T2);
+
+      T  = (T * Q2) + (P * T2);
+      P *= P2;
+      Q *= Q2;
+    }
+  }
+
+  // Compute the sum T / Q of the series with an error of less than 2^-(bits + 2).
+  template<typename SeriesType>
+  void constant_series_sum(const int bits, wide_integer_type& Q, wide_integer_type& T)
+  {
+    wide_integer_type P;
+
+    constant_binary_splitting<SeriesType>(0U, SeriesType::term_count(bits + 2), P, Q, T);
+  }
+
+  // The Chudnovsky series with 1/pi = (12 / 640320^(3/2)) * sum_k (-1)^k (6k)! (13591409 + 545140134 k) / ((3k)! (k!)^3 640320^(3k)).
+  // Each term adds about 47 bits.
+  struct constant_pi
+  {
+    static std::uint32_t term_count(const int bits) { return std::uint32_t(bits / 47) + 2U; }
+
+    static wide_integer_type p(const std::uint32_t k)
+    {
+      return ((k == 0U) ? wide_integer_type(1)
+                        : wide_integer_type(-(wide_integer_type(6U * k - 5U) * (2U * k - 1U)) * (6U * k - 1U)));
+    }
+
+    static wide_integer_type q(const std::uint32_t k)
+    {
+      return ((k == 0U) ? wide_integer_type(1)
+                        : wide_integer_type(((wide_integer_type(k) * k) * k) * UINT64_C(10939058860032000)));
+    }
+
+    static wide_integer_type a(const std::uint32_t k)
+    {
+      return wide_integer_type(13591409U) + (wide_integer_type(545140134U) * k);
+    }
+
+    // Return pi * 2^bits, using pi = 426880 sqrt(10005) * Q / T.
+    static wide_integer_type compute(const int bits)
+    {
+      wide_integer_type Q;
+      wide_integer_type T;
+
+      constant_series_sum<constant_pi>(bits, Q, T);
+
+      const wide_integer_type root = wide_integer_sqrt(wide_integer_type(10005U) << (2 * bits));
+
+      return ((root * Q) * 426880U) / T;
+    }
+  };
+
+  // The series e = sum_k 1 / k!.
+  struct constant_e
+  {
+    static std::uint32_t term_count(const int bits)
+    {
+      // Find the number of terms n with n! > 2^bits.
+      std::uint32_t n = 1U;
+
+      for(int b = 0; b < bits; )
+      {
+        ++n;
+
+        b += wide_integer_msb(wide_integer_type(n));
+      }
+
+      return n + 1U;
+    }
+
+    static wide_integer_type p(const std::uint32_t)   { return wide_integer_type(1); }
+    static wide_integer_type q(const std::uint32_t k) { return ((k == 0U) ? wide_integer_type(1) : wide_integer_type(k)); }
+    static wide_integer_type a(const std::uint32_t)   { return wide_integer_type(1); }
+
+    // Return e * 2^bits.
+    static wide_integer_type compute(const int bits)
+    {
+      wide_integer_type Q;
+      wide_integer_type T;
+
+      constant_series_sum<constant_e>(bits, Q, T);
+
+      return (T << bits) / Q;
+    }
+  };
+
+  // The series log(2) = (3/4) sum_k (-1)^k (k!)^2 / (2^k (2k + 1)!).
+  // Each term adds 3 bits.
+  struct constant_ln_two
+  {
+    static std::uint32_t term_count(const int bits) { return std::uint32_t(bits / 3) + 2U; }
+
+    static wide_integer_type p(const std::uint32_t k) { return ((k == 0U) ? wide_integer_type(1) : wide_integer_type(-wide_integer_type(k))); }
+    static wide_integer_type q(const std::uint32_t k) { return ((k == 0U) ? wide_integer_type(1) : wide_integer_type(wide_integer_type(2U * k + 1U) * 4U)); }
+    static wide_integer_type a(const std::uint32_t)   { return wide_integer_type(1); }
+
+    // Return log(2) * 2^bits.
+    static wide_integer_type compute(const int bits)
+    {
+      wide_integer_type Q;
+      wide_integer_type T;
+
+      constant_series_sum<constant_ln_two>(bits, Q, T);
+
+      return ((T * 3U) << bits) / (Q * 4U);
+    }
+  };
+
+  struct constant_root_two
+  {
+    // Return sqrt(2) * 2^bits.
+    static wide_integer_type compute(const int bits)
+    {
+      return wide_integer_sqrt(wide_integer_type(2U) << (2 * bits));
+    }
+  };
+
+  // Return the constant multiplied with 2^bits and rounded to nearest.
+  // The constant is cached with a number of bits that is a power of two
+  // and exceeds the requested bits by at least 32 guard bits.
+  // Narrower requests are derived from the cached value by shifting.
+  // A wider request replaces the cached value.
+  template<typename ConstantType>
+  wide_integer_type wide_constant_representation(const int bits)
+  {
+    static std::mutex        cache_mutex;
+    static wide_integer_type cache_value;
+    static int               cache_bits = 0;
+
+    BOOST_CONSTEXPR_OR_CONST int guard_bits = 32;
+
+    const std::lock_guard<std::mutex> lock(cache_mutex);
+
+    if(cache_bits < (bits + guard_bits))
+    {
+      int new_bits = 256;
+
+      while(new_bits < (bits + guard_bits))
+      {
+        new_bits *= 2;
+      }
+
+      cache_value = ConstantType::compute(new_bits);
+      cache_bits  = new_bits;
+    }
+
+    const int shift = cache_bits - bits;
+
+    return (cache_value + (wide_integer_type(1U) << (shift - 1))) >> shift;
+  }
+
+  // The series log(5/4) = 2 atanh(1/9) = (2/9) sum_k (1/81)^k / (2k + 1).
+  // Each term adds about 6 bits.
+  struct constant_ln_five_quarters
+  {
+    static std::uint32_t term_count(const int bits) { return std::uint32_t(bits / 6) + 2U; }
+
+    static wide_integer_type p(const std::uint32_t k) { return ((k == 0U) ? wide_integer_type(1) : wide_integer_type(2U * k - 1U)); }
+    static wide_integer_type q(const std::uint32_t k) { return ((k == 0U) ? wide_integer_type(1) : wide_integer_type(wide_integer_type(2U * k + 1U) * 81U)); }
+    static wide_integer_type a(const std::uint32_t)   { return wide_integer_type(1); }
+  };
+
+  // The further constants described in fixed_point_detail_constants.hpp.
+  // They are derived from the cached constants above with 8 guard bits.
+  template<typename DigitsType>
+  struct wide_constant;
+
+  template<>
+  struct wide_constant<constant_digits_ln_ten>
+  {
+    // Return log(10) * 2^bits, using log(10) = 3 log(2) + log(5/4).
+    static wide_integer_type compute(const int bits)
+    {
+      wide_integer_type Q;
+      wide_integer_type T;
+
+      constant_series_sum<constant_ln_five_quarters>(bits + 8, Q, T);
+
+      const wide_integer_type ln_five_quarters = ((T * 2U) << (bits + 8)) / (Q * 9U);
+
+      return ((wide_constant_representation<constant_ln_two>(bits + 8) * 3U) + ln_five_quarters) >> 8;
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_inv_ln_two>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return (wide_integer_type(1U) << ((2 * bits) + 8)) / wide_constant_representation<constant_ln_two>(bits + 8);
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_inv_ln_ten>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return (wide_integer_type(1U) << ((2 * bits) + 8)) / wide_constant_representation<wide_constant<constant_digits_ln_ten>>(bits + 8);
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_two_over_pi>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return (wide_integer_type(1U) << ((2 * bits) + 9)) / wide_constant_representation<constant_pi>(bits + 8);
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_pi_quarter>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return wide_constant_representation<constant_pi>(bits - 2);
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_inv_pi>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return wide_constant_representation<wide_constant<constant_digits_two_over_pi>>(bits - 1);
+    }
+  };
+
+  template<>
+  struct wide_constant<constant_digits_sqrt_pi>
+  {
+    static wide_integer_type compute(const int bits)
+    {
+      return wide_integer_sqrt(wide_constant_representation<constant_pi>(bits) << bits);
+    }
+  };
+
+  } } } // namespace boost::fixed_point::detail
+
+  #endif // !BOOST_FIXED_POINT_DISABLE_MULTIPRECISION
+
+#endif // FIXED_POINT_DETAIL_CONSTANTS_BINARY_SPLITTING_2016_11_19_HPP_
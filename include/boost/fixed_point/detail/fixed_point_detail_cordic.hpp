@@ -0,0 +1,313 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_cordic.hpp implements the shift-and-add
+// CORDIC iterations in circular and hyperbolic coordinates.
+// The iterations run on a signed integral working type having
+// FractionalBits fractional bits. The angle tables and the
+// gain constants are scaled to the same fractional bits.
+
+#ifndef FIXED_POINT_DETAIL_CORDIC_2016_11_08_HPP_
+  #define FIXED_POINT_DETAIL_CORDIC_2016_11_08_HPP_
+
+  #include <cmath>
+  #include <cstdint>
+  #include <type_traits>
+  #include <vector>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  // Right-shift a signed integral value, truncating toward zero.
+  // This avoids the implementation-defined right shift of negative values.
+  template<typename SignedIntegralType>
+  SignedIntegralType cordic_shift_right(const SignedIntegralType& u, const int n)
+  {
+    return ((u < 0) ? SignedIntegralType(-SignedIntegralType(SignedIntegralType(-u) >> n))
+                    : SignedIntegralType(u >> n));
+  }
+
+  // The hyperbolic iterations start at index 1, and the iterations
+  // with index 4, 13, 40, ..., 3k+1 are repeated for convergence.
+  inline bool cordic_hyperbolic_index_repeats(const int i)
+  {
+    int k = 4;
+
+    while(k < i)
+    {
+      k = (3 * k) + 1;
+    }
+
+    return (k == i);
+  }
+
+  template<typename SignedIntegralType,
+           const int FractionalBits,
+           typename EnableType = void>
+  struct cordic_table;
+
+  // The CORDIC tables for up to 62 fractional bits are taken
+  // from 64-bit hexadecimal values in Q63 (or Q62) notation
+  // that are right-shifted to the requested number of bits.
+  template<typename SignedIntegralType,
+           const int FractionalBits>
+  struct cordic_table<SignedIntegralType,
+                      FractionalBits,
+                      typename std::enable_if<(FractionalBits <= 62)>::type>
+  {
+    // The table of atan(2^-i), for i = 0...63.
+    static SignedIntegralType circular_angle(const int i)
+    {
+      static const std::uint64_t table[64U] =
+      {
+        UINT64_C(0x6487ED5110B4611A), UINT64_C(0x3B58CE0AC3769ED1), UINT64_C(0x1F5B75F92C80DD63), UINT64_C(0x0FEADD4D5617B6E3),
+        UINT64_C(0x07FD56EDCB3F7A72), UINT64_C(0x03FFAAB7752EC495), UINT64_C(0x01FFF555BBB729AB), UINT64_C(0x00FFFEAAADDDD4B9),
+        UINT64_C(0x007FFFD5556EEEDD), UINT64_C(0x003FFFFAAAAB7777), UINT64_C(0x001FFFFF55555BBC), UINT64_C(0x000FFFFFEAAAAADE),
+        UINT64_C(0x0007FFFFFD555557), UINT64_C(0x0003FFFFFFAAAAAB), UINT64_C(0x0001FFFFFFF55555), UINT64_C(0x0000FFFFFFFEAAAB),
+        UINT64_C(0x00007FFFFFFFD555), UINT64_C(0x00003FFFFFFFFAAB), UINT64_C(0x00001FFFFFFFFF55), UINT64_C(0x00000FFFFFFFFFEB),
+        UINT64_C(0x000007FFFFFFFFFD), UINT64_C(0x0000040000000000), UINT64_C(0x0000020000000000), UINT64_C(0x0000010000000000),
+        UINT64_C(0x0000008000000000), UINT64_C(0x0000004000000000), UINT64_C(0x0000002000000000), UINT64_C(0x0000001000000000),
+        UINT64_C(0x0000000800000000), UINT64_C(0x0000000400000000), UINT64_C(0x0000000200000000), UINT64_C(0x0000000100000000),
+        UINT64_C(0x0000000080000000), UINT64_C(0x0000000040000000), UINT64_C(0x0000000020000000), UINT64_C(0x0000000010000000),
+        UINT64_C(0x0000000008000000), UINT64_C(0x0000000004000000), UINT64_C(0x0000000002000000), UINT64_C(0x0000000001000000),
+        UINT64_C(0x0000000000800000), UINT64_C(0x0000000000400000), UINT64_C(0x0000000000200000), UINT64_C(0x0000000000100000),
+        UINT64_C(0x0000000000080000), UINT64_C(0x0000000000040000), UINT64_C(0x0000000000020000), UINT64_C(0x0000000000010000),
+        UINT64_C(0x0000000000008000), UINT64_C(0x0000000000004000), UINT64_C(0x0000000000002000), UINT64_C(0x0000000000001000),
+        UINT64_C(0x0000000000000800), UINT64_C(0x0000000000000400), UINT64_C(0x0000000000000200), UINT64_C(0x0000000000000100),
+        UINT64_C(0x0000000000000080), UINT64_C(0x0000000000000040), UINT64_C(0x0000000000000020), UINT64_C(0x0000000000000010),
+        UINT64_C(0x0000000000000008), UINT64_C(0x0000000000000004), UINT64_C(0x0000000000000002), UINT64_C(0x0000000000000001)
+      };
+
+      return SignedIntegralType(table[i] >> (63 - FractionalBits));
+    }
+
+    // The table of atanh(2^-i), for i = 1...63. The element at index 0 is unused.
+    static SignedIntegralType hyperbolic_angle(const int i)
+    {
+      static const std::uint64_t table[64U] =
+      {
+        UINT64_C(0x0000000000000000), UINT64_C(0x464FA9EAB40C2A5E), UINT64_C(0x20B15DF50228A34E), UINT64_C(0x1015891C9EAEF76A),
+        UINT64_C(0x0802AC4569BAD66E), UINT64_C(0x04005562246BB893), UINT64_C(0x02000AAB1115A393), UINT64_C(0x01000155588891AD),
+        UINT64_C(0x0080002AAAC44457), UINT64_C(0x0040000555562222), UINT64_C(0x00200000AAAAB111), UINT64_C(0x0010000015555589),
+        UINT64_C(0x0008000002AAAAAC), UINT64_C(0x0004000000555555), UINT64_C(0x00020000000AAAAB), UINT64_C(0x0001000000015555),
+        UINT64_C(0x0000800000002AAB), UINT64_C(0x0000400000000555), UINT64_C(0x00002000000000AB), UINT64_C(0x0000100000000015),
+        UINT64_C(0x0000080000000003), UINT64_C(0x0000040000000000), UINT64_C(0x0000020000000000), UINT64_C(0x0000010000000000),
+        UINT64_C(0x0000008000000000), UINT64_C(0x0000004000000000), UINT64_C(0x0000002000000000), UINT64_C(0x0000001000000000),
+        UINT64_C(0x0000000800000000), UINT64_C(0x0000000400000000), UINT64_C(0x0000000200000000), UINT64_C(0x0000000100000000),
+        UINT64_C(0x0000000080000000), UINT64_C(0x0000000040000000), UINT64_C(0x0000000020000000), UINT64_C(0x0000000010000000),
+        UINT64_C(0x0000000008000000), UINT64_C(0x0000000004000000), UINT64_C(0x0000000002000000), UINT64_C(0x0000000001000000),
+        UINT64_C(0x0000000000800000), UINT64_C(0x0000000000400000), UINT64_C(0x0000000000200000), UINT64_C(0x0000000000100000),
+        UINT64_C(0x0000000000080000), UINT64_C(0x0000000000040000), UINT64_C(0x0000000000020000), UINT64_C(0x0000000000010000),
+        UINT64_C(0x0000000000008000), UINT64_C(0x0000000000004000), UINT64_C(0x0000000000002000), UINT64_C(0x0000000000001000),
+        UINT64_C(0x0000000000000800), UINT64_C(0x0000000000000400), UINT64_C(0x0000000000000200), UINT64_C(0x0000000000000100),
+        UINT64_C(0x0000000000000080), UINT64_C(0x0000000000000040), UINT64_C(0x0000000000000020), UINT64_C(0x0000000000000010),
+        UINT64_C(0x0000000000000008), UINT64_C(0x0000000000000004), UINT64_C(0x0000000000000002), UINT64_C(0x0000000000000001)
+      };
+
+      return SignedIntegralType(table[i] >> (63 - FractionalBits));
+    }
+
+    // The inverse of the circular CORDIC gain, 0.60725293500888125...
+    static SignedIntegralType circular_gain_inverse()    { return SignedIntegralType(UINT64_C(0x4DBA76D421AF2D34) >> (63 - FractionalBits)); }
+
+    // The inverse of the hyperbolic CORDIC gain, 1.20749706776307212...
+    static SignedIntegralType hyperbolic_gain_inverse()  { return SignedIntegralType(UINT64_C(0x4D47A1C803BB08CA) >> (62 - FractionalBits)); }
+
+    static SignedIntegralType pi_half()                  { return SignedIntegralType(UINT64_C(0x6487ED5110B4611A) >> (62 - FractionalBits)); }
+    static SignedIntegralType ln_two()                   { return SignedIntegralType(UINT64_C(0x58B90BFBE8E7BCD6) >> (63 - FractionalBits)); }
+  };
+
+  // The CORDIC tables for more than 62 fractional bits are computed
+  // once (on first use) with a floating-point type having 32 extra bits.
+  template<typename SignedIntegralType,
+           const int FractionalBits>
+  struct cordic_table<SignedIntegralType,
+                      FractionalBits,
+                      typename std::enable_if<(FractionalBits > 62)>::type>
+  {
+  private:
+    typedef typename float_type_helper<std::uint32_t(FractionalBits + 32)>::exact_float_type FloatingPointType;
+
+  public:
+    static SignedIntegralType circular_angle(const int i)
+    {
+      static const std::vector<SignedIntegralType> table = make_angle_table(true);
+
+      return table[std::size_t(i)];
+    }
+
+    static SignedIntegralType hyperbolic_angle(const int i)
+    {
+      static const std::vector<SignedIntegralType> table = make_angle_table(false);
+
+      return table[std::size_t(i)];
+    }
+
+    static SignedIntegralType circular_gain_inverse()
+    {
+      static const SignedIntegralType value = make_gain_inverse(true);
+
+      return value;
+    }
+
+    static SignedIntegralType hyperbolic_gain_inverse()
+    {
+      static const SignedIntegralType value = make_gain_inverse(false);
+
+      return value;
+    }
+
+    static SignedIntegralType pi_half()
+    {
+      static const SignedIntegralType value = to_integral(calculate_pi<FloatingPointType>() / 2U);
+
+      return value;
+    }
+
+    static SignedIntegralType ln_two()
+    {
+      static const SignedIntegralType value = to_integral(calculate_ln_two<FloatingPointType>());
+
+      return value;
+    }
+
+  private:
+    static SignedIntegralType to_integral(const FloatingPointType& x)
+    {
+      using std::ldexp;
+
+      return SignedIntegralType(ldexp(x, FractionalBits) + FloatingPointType(0.5F));
+    }
+
+    static std::vector<SignedIntegralType> make_angle_table(const bool is_circular)
+    {
+      using std::atan;
+      using std::ldexp;
+      using std::log;
+
+      std::vector<SignedIntegralType> table(std::size_t(FractionalBits + 1));
+
+      for(int i = 0; i <= FractionalBits; ++i)
+      {
+        const FloatingPointType u = ldexp(FloatingPointType(1), -i);
+
+        if(is_circular)
+        {
+          table[std::size_t(i)] = to_integral(atan(u));
+        }
+        else if(i > 0)
+        {
+          // Compute atanh(u) = log((1 + u) / (1 - u)) / 2.
+          table[std::size_t(i)] = to_integral(log((1U + u) / (1U - u)) / 2U);
+        }
+      }
+
+      return table;
+    }
+
+    static SignedIntegralType make_gain_inverse(const bool is_circular)
+    {
+      using std::ldexp;
+      using std::sqrt;
+
+      FloatingPointType gain(1);
+
+      for(int i = (is_circular ? 0 : 1); i <= FractionalBits; ++i)
+      {
+        const FloatingPointType u2 = ldexp(FloatingPointType(1), -2 * i);
+
+        if(is_circular)
+        {
+          gain *= sqrt(1U + u2);
+        }
+        else
+        {
+          gain *= sqrt(1U - u2);
+
+          if(cordic_hyperbolic_index_repeats(i))
+          {
+            gain *= sqrt(1U - u2);
+          }
+        }
+      }
+
+      return to_integral(1U / gain);
+    }
+  };
+
+  // Rotation mode in circular coordinates: drive z to zero.
+  // Starting from (x, y), the result is (x cos z - y sin z, y cos z + x sin z),
+  // multiplied by the circular CORDIC gain.
+  template<typename TableType, typename SignedIntegralType>
+  void cordic_circular_rotate(SignedIntegralType& x, SignedIntegralType& y, SignedIntegralType& z, const int iterations)
+  {
+    for(int i = 0; i < iterations; ++i)
+    {
+      const SignedIntegralType xs = cordic_shift_right(x, i);
+      const SignedIntegralType ys = cordic_shift_right(y, i);
+
+      if(z < 0) { x += ys; y -= xs; z += TableType::circular_angle(i); }
+      else      { x -= ys; y += xs; z -= TableType::circular_angle(i); }
+    }
+  }
+
+  // Vectoring mode in circular coordinates: drive y to zero.
+  // For x > 0, the result is x = gain * sqrt(x^2 + y^2) and z = z + atan(y / x).
+  template<typename TableType, typename SignedIntegralType>
+  void cordic_circular_vector(SignedIntegralType& x, SignedIntegralType& y, SignedIntegralType& z, const int iterations)
+  {
+    for(int i = 0; i < iterations; ++i)
+    {
+      const SignedIntegralType xs = cordic_shift_right(x, i);
+      const SignedIntegralType ys = cordic_shift_right(y, i);
+
+      if(y < 0) { x -= ys; y += xs; z -= TableType::circular_angle(i); }
+      else      { x += ys; y -= xs; z += TableType::circular_angle(i); }
+    }
+  }
+
+  // Rotation mode in hyperbolic coordinates: drive z to zero.
+  // Starting from (x, y), the result is (x cosh z + y sinh z, y cosh z + x sinh z),
+  // multiplied by the hyperbolic CORDIC gain.
+  template<typename TableType, typename SignedIntegralType>
+  void cordic_hyperbolic_rotate(SignedIntegralType& x, SignedIntegralType& y, SignedIntegralType& z, const int iterations)
+  {
+    for(int i = 1; i <= iterations; ++i)
+    {
+      for(int pass = (cordic_hyperbolic_index_repeats(i) ? 0 : 1); pass < 2; ++pass)
+      {
+        const SignedIntegralType xs = cordic_shift_right(x, i);
+        const SignedIntegralType ys = cordic_shift_right(y, i);
+
+        if(z < 0) { x -= ys; y -= xs; z += TableType::hyperbolic_angle(i); }
+        else      { x += ys; y += xs; z -= TableType::hyperbolic_angle(i); }
+      }
+    }
+  }
+
+  // Multiply the non-negative value x by the constant c < 1
+  // with shifts and additions only.
+  template<typename SignedIntegralType>
+  SignedIntegralType cordic_scale(const SignedIntegralType& x, const SignedIntegralType& c, const int fractional_bits)
+  {
+    SignedIntegralType result(0);
+
+    for(int b = 1; b <= fractional_bits; ++b)
+    {
+      if((SignedIntegralType(c >> (fractional_bits - b)) & 1) != 0)
+      {
+        result += (x >> b);
+      }
+    }
+
+    return result;
+  }
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_CORDIC_2016_11_08_HPP_
@@ -0,0 +1,580 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_minimax.hpp provides the coefficients of minimax
+// polynomial approximations of elementary functions for the resolution
+// tiers of 32, 48 and 64 fractional bits.
+//
+// This file has been generated by tools/fixed_point_minimax_coefficients.cpp.
+// Do not edit it by hand.
+
+#ifndef FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_
+  #define FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_
+
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  // A coefficient has the value (-1)^is_neg * mantissa * 2^exponent.
+  struct minimax_coefficient
+  {
+    std::uint64_t mantissa;
+    int           exponent;
+    bool          is_neg;
+  };
+
+  // Select the tier of the coefficients for a given fractional resolution.
+  // The tier is zero if no coefficients are available.
+  template<const int RadixSplit>
+  struct minimax_tier
+  {
+    BOOST_STATIC_CONSTEXPR int value = ((RadixSplit <= 32) ? 32
+                                     : ((RadixSplit <= 48) ? 48
+                                     : ((RadixSplit <= 64) ? 64 : 0)));
+  };
+
+  // sin(x) = x * P(x^2), for 0 <= x <= pi/4.
+  template<const int Tier>
+  struct minimax_sin;
+
+  template<>
+  struct minimax_sin<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 5U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 37;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFB407CA2),  -64, false },  // c0
+        { UINT64_C(0xAAAAAAA4A5FB2682),  -66, true  },  // c1
+        { UINT64_C(0x888883A69642FD76),  -70, false },  // c2
+        { UINT64_C(0xD0077496FCC71513),  -76, true  },  // c3
+        { UINT64_C(0xB65BC5F46D7476A1),  -82, false }   // c4
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_sin<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 7U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 58;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFFFFFFC6),  -64, false },  // c0
+        { UINT64_C(0xAAAAAAAAAAAA1AAB),  -66, true  },  // c1
+        { UINT64_C(0x88888888879F0341),  -70, false },  // c2
+        { UINT64_C(0xD00D00CDD4EA3AE5),  -76, true  },  // c3
+        { UINT64_C(0xB8EF1A9886241C2E),  -82, false },  // c4
+        { UINT64_C(0xD72F1C17888994ED),  -89, true  },  // c5
+        { UINT64_C(0xAEC3BE5E235C1434),  -96, false }   // c6
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_sin<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 8U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 68;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0xAAAAAAAAAAAAAA8F),  -66, true  },  // c1
+        { UINT64_C(0x8888888888884E63),  -70, false },  // c2
+        { UINT64_C(0xD00D00D00C443BEE),  -76, true  },  // c3
+        { UINT64_C(0xB8EF1D2989DE962B),  -82, false },  // c4
+        { UINT64_C(0xD732293809AAFD94),  -89, true  },  // c5
+        { UINT64_C(0xB0903E7677724C2C),  -96, false },  // c6
+        { UINT64_C(0xD54DEC22EFB8E0DA), -104, true  }   // c7
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // cos(x) = P(x^2), for 0 <= x <= pi/4.
+  template<const int Tier>
+  struct minimax_cos;
+
+  template<>
+  struct minimax_cos<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 5U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 34;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFCBE23587),  -64, false },  // c0
+        { UINT64_C(0xFFFFFFDEF74AEE13),  -65, true  },  // c1
+        { UINT64_C(0xAAAA9D43AD84C650),  -68, false },  // c2
+        { UINT64_C(0xB603C3126F22B94F),  -73, true  },  // c3
+        { UINT64_C(0xCC837FEAA706F54A),  -79, false }   // c4
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_cos<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 7U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 54;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFFFFFC9B),  -64, false },  // c0
+        { UINT64_C(0xFFFFFFFFFFFBC947),  -65, true  },  // c1
+        { UINT64_C(0xAAAAAAAAA73FF21C),  -68, false },  // c2
+        { UINT64_C(0xB60B60B1E358F26A),  -73, true  },  // c3
+        { UINT64_C(0xD00CFBFF2C04BC81),  -79, false },  // c4
+        { UINT64_C(0x93EFA02AAB3943C6),  -85, true  },  // c5
+        { UINT64_C(0x8DC584CFA25EF1A9),  -92, false }   // c6
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_cos<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 9U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 75;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0x8000000000000000),  -64, true  },  // c1
+        { UINT64_C(0xAAAAAAAAAAAAAA77),  -68, false },  // c2
+        { UINT64_C(0xB60B60B60B604B6E),  -73, true  },  // c3
+        { UINT64_C(0xD00D00D00C2289DA),  -79, false },  // c4
+        { UINT64_C(0x93F27DBAC0A6D6A9),  -85, true  },  // c5
+        { UINT64_C(0x8F76C61986ABDF69),  -92, false },  // c6
+        { UINT64_C(0xC9C966745811E102), -100, true  },  // c7
+        { UINT64_C(0xD54DE7D72E49EE36), -108, false }   // c8
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // exp(x) = P(x), for -log(2)/2 <= x <= +log(2)/2.
+  template<const int Tier>
+  struct minimax_exp;
+
+  template<>
+  struct minimax_exp<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 8U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 34;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFD3864510),  -64, false },  // c0
+        { UINT64_C(0xFFFFFFFFD8777CA1),  -64, false },  // c1
+        { UINT64_C(0x8000002E46EC4807),  -64, false },  // c2
+        { UINT64_C(0xAAAAAAE339B92C20),  -66, false },  // c3
+        { UINT64_C(0xAAAA324DBA447D21),  -68, false },  // c4
+        { UINT64_C(0x88882D98B0CBA1B2),  -70, false },  // c5
+        { UINT64_C(0xB6D3AB7338DFA4CE),  -73, false },  // c6
+        { UINT64_C(0xD0EB8A6BDE9EE57F),  -76, false }   // c7
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_exp<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 11U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 52;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFFFFFF8F),  -64, false },  // c0
+        { UINT64_C(0x800000000000F2F4),  -63, false },  // c1
+        { UINT64_C(0x800000000000E08C),  -64, false },  // c2
+        { UINT64_C(0xAAAAAAAAA5BA95C7),  -66, false },  // c3
+        { UINT64_C(0xAAAAAAAAA60736E7),  -68, false },  // c4
+        { UINT64_C(0x88888896EB787E69),  -70, false },  // c5
+        { UINT64_C(0xB60B60C85AA995CC),  -73, false },  // c6
+        { UINT64_C(0xD00CBC62BB95425A),  -76, false },  // c7
+        { UINT64_C(0xD00CBE75E8165789),  -79, false },  // c8
+        { UINT64_C(0xB97D78A820904DEE),  -82, false },  // c9
+        { UINT64_C(0x9462A64A3FB5C02C),  -85, false }   // c10
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_exp<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 14U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 70;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0x8000000000000000),  -63, false },  // c1
+        { UINT64_C(0xFFFFFFFFFFFFFFF1),  -65, false },  // c2
+        { UINT64_C(0xAAAAAAAAAAAAAAA1),  -66, false },  // c3
+        { UINT64_C(0xAAAAAAAAAAAAEA11),  -68, false },  // c4
+        { UINT64_C(0x888888888888B8D6),  -70, false },  // c5
+        { UINT64_C(0xB60B60B609D4DFCB),  -73, false },  // c6
+        { UINT64_C(0xD00D00D00B4DAA67),  -76, false },  // c7
+        { UINT64_C(0xD00D00D93EB42B60),  -79, false },  // c8
+        { UINT64_C(0xB8EF1D32A69AD94C),  -82, false },  // c9
+        { UINT64_C(0x93F261ABF71BDF08),  -85, false },  // c10
+        { UINT64_C(0xD7320335A32D27F4),  -89, false },  // c11
+        { UINT64_C(0x8FCBB45221C93AC9),  -92, false },  // c12
+        { UINT64_C(0xB0F9B779EFD4586C),  -96, false }   // c13
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // expm1(x) = x * P(x), for -log(2)/2 <= x <= +log(2)/2.
+  template<const int Tier>
+  struct minimax_expm1;
+
+  template<>
+  struct minimax_expm1<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 8U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 37;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFB0F98C5),  -64, false },  // c0
+        { UINT64_C(0xFFFFFFFFF818E51C),  -65, false },  // c1
+        { UINT64_C(0xAAAAAABF394D1885),  -66, false },  // c2
+        { UINT64_C(0xAAAAAAC1479FCA74),  -68, false },  // c3
+        { UINT64_C(0x8888531014FA24E1),  -70, false },  // c4
+        { UINT64_C(0xB60B17FDC47B5B27),  -73, false },  // c5
+        { UINT64_C(0xD0BEFADC9204680C),  -76, false },  // c6
+        { UINT64_C(0xD0BEFA94E38BE1FA),  -79, false }   // c7
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_expm1<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 11U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 55;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFFFFFFF7),  -64, false },  // c0
+        { UINT64_C(0x800000000000287B),  -64, false },  // c1
+        { UINT64_C(0xAAAAAAAAAAAAEFBD),  -66, false },  // c2
+        { UINT64_C(0xAAAAAAAAA9056FD0),  -68, false },  // c3
+        { UINT64_C(0x88888888871B44C9),  -70, false },  // c4
+        { UINT64_C(0xB60B60BFA1F44D3A),  -73, false },  // c5
+        { UINT64_C(0xD00D00DB50B53744),  -76, false },  // c6
+        { UINT64_C(0xD00CD334DDCB9BF6),  -79, false },  // c7
+        { UINT64_C(0xB8EEF4583446E9A6),  -82, false },  // c8
+        { UINT64_C(0x945160A9B8C5B77A),  -85, false },  // c9
+        { UINT64_C(0xD7BC2F6F3A1CC77F),  -89, false }   // c10
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_expm1<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 13U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 68;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0xFFFFFFFFFFFFFFFC),  -65, false },  // c1
+        { UINT64_C(0xAAAAAAAAAAAAAAA7),  -66, false },  // c2
+        { UINT64_C(0xAAAAAAAAAAAAC819),  -68, false },  // c3
+        { UINT64_C(0x888888888888A27E),  -70, false },  // c4
+        { UINT64_C(0xB60B60B60A6BB18C),  -73, false },  // c5
+        { UINT64_C(0xD00D00D00BDD4DC2),  -76, false },  // c6
+        { UINT64_C(0xD00D00D6E14DCB47),  -79, false },  // c7
+        { UINT64_C(0xB8EF1D30E02E1A3D),  -82, false },  // c8
+        { UINT64_C(0x93F2660C052352AE),  -85, false },  // c9
+        { UINT64_C(0xD73208A77C27E765),  -89, false },  // c10
+        { UINT64_C(0x8FC5A227A56A09F3),  -92, false },  // c11
+        { UINT64_C(0xB0F33DB304F6E309),  -96, false }   // c12
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // log(x) = 2 * s * P(s^2), s = (x - 1) / (x + 1), 1/sqrt(2) <= x <= sqrt(2).
+  template<const int Tier>
+  struct minimax_log;
+
+  template<>
+  struct minimax_log<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 5U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 37;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x800000000253C0EA),  -63, false },  // c0
+        { UINT64_C(0xAAAAAA6D36F8D44A),  -65, false },  // c1
+        { UINT64_C(0xCCCD4E89727F25EC),  -66, false },  // c2
+        { UINT64_C(0x92195247838A3F06),  -66, false },  // c3
+        { UINT64_C(0xF1D9A6582BD4A0B1),  -67, false }   // c4
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_log<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 7U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 52;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x800000000000063D),  -63, false },  // c0
+        { UINT64_C(0xAAAAAAAAA9675B85),  -65, false },  // c1
+        { UINT64_C(0xCCCCCCD2243A1366),  -66, false },  // c2
+        { UINT64_C(0x92492056B7E06277),  -66, false },  // c3
+        { UINT64_C(0xE3916948D5008C7B),  -67, false },  // c4
+        { UINT64_C(0xB9913B36A74C92FC),  -67, false },  // c5
+        { UINT64_C(0xAC6EAE7084E8C6F8),  -67, false }   // c6
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_log<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 9U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 66;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0xAAAAAAAAAAAAA4A3),  -65, false },  // c1
+        { UINT64_C(0xCCCCCCCCCCF758AA),  -66, false },  // c2
+        { UINT64_C(0x924924920F6105AB),  -66, false },  // c3
+        { UINT64_C(0xE38E393212597D8D),  -67, false },  // c4
+        { UINT64_C(0xBA2E6DB2AB4008F0),  -67, false },  // c5
+        { UINT64_C(0x9D90896CF185B36B),  -67, false },  // c6
+        { UINT64_C(0x87AA77C19B5D0F69),  -67, false },  // c7
+        { UINT64_C(0x87D0F30F8C5ADD6B),  -67, false }   // c8
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // atan(x) = x * P(x^2), for 0 <= x <= tan(pi/8).
+  template<const int Tier>
+  struct minimax_atan;
+
+  template<>
+  struct minimax_atan<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 7U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 35;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFE9D37C11),  -64, false },  // c0
+        { UINT64_C(0xAAAAAA45A8AFF351),  -65, true  },  // c1
+        { UINT64_C(0xCCCC8193BB4C3858),  -66, false },  // c2
+        { UINT64_C(0x923E976A78FA3AFB),  -66, true  },  // c3
+        { UINT64_C(0xE221DE314CA02C77),  -67, false },  // c4
+        { UINT64_C(0xAD4D5B0A839E2C86),  -67, true  },  // c5
+        { UINT64_C(0xC146A7C9607F5FC1),  -68, false }   // c6
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_atan<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 11U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 54;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xFFFFFFFFFFFFFDAC),  -64, false },  // c0
+        { UINT64_C(0xAAAAAAAAAA90AD57),  -65, true  },  // c1
+        { UINT64_C(0xCCCCCCCC9CCAE5EE),  -66, false },  // c2
+        { UINT64_C(0x92492480F94443F3),  -66, true  },  // c3
+        { UINT64_C(0xE38E3278F2CAB2F6),  -67, false },  // c4
+        { UINT64_C(0xBA2DD973EBFF1C82),  -67, true  },  // c5
+        { UINT64_C(0x9D7DBAB89A8DBEEF),  -67, false },  // c6
+        { UINT64_C(0x87FFCCC9C7F6CB16),  -67, true  },  // c7
+        { UINT64_C(0xE910FA06D43C2225),  -68, false },  // c8
+        { UINT64_C(0xB24ACE497080693D),  -68, true  },  // c9
+        { UINT64_C(0xAD98F4C789A23C2F),  -69, false }   // c10
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_atan<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 14U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 69;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0x8000000000000000),  -63, false },  // c0
+        { UINT64_C(0xAAAAAAAAAAAAAA23),  -65, true  },  // c1
+        { UINT64_C(0xCCCCCCCCCCCB37FF),  -66, false },  // c2
+        { UINT64_C(0x924924924835DC16),  -66, true  },  // c3
+        { UINT64_C(0xE38E38E2FB2EE3F5),  -67, false },  // c4
+        { UINT64_C(0xBA2E8B87BEAFCC55),  -67, true  },  // c5
+        { UINT64_C(0x9D89D55B88CF4B82),  -67, false },  // c6
+        { UINT64_C(0x8888446E8F69C6DC),  -67, true  },  // c7
+        { UINT64_C(0xF0E92778D3D6DE7F),  -68, false },  // c8
+        { UINT64_C(0xD74354531D59942F),  -68, true  },  // c9
+        { UINT64_C(0xC0B76FADDFFB1B95),  -68, false },  // c10
+        { UINT64_C(0xA603BA9134C1CD8D),  -68, true  },  // c11
+        { UINT64_C(0xF242053F03B02BE2),  -69, false },  // c12
+        { UINT64_C(0xD41DC40D5277CB38),  -70, true  }   // c13
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  // sqrt(x) = P(x), for 1/4 <= x <= 1, as an initial estimate.
+  template<const int Tier>
+  struct minimax_sqrt;
+
+  template<>
+  struct minimax_sqrt<32>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 4U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 10;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xE1A1102B6F8AD5F9),  -66, false },  // c0
+        { UINT64_C(0xA6AAA65A047F0F3B),  -63, false },  // c1
+        { UINT64_C(0xC9EF50E9C3294CC0),  -64, true  },  // c2
+        { UINT64_C(0x88C3D3F820F41282),  -65, false }   // c3
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_sqrt<48>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 4U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 10;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xE1A1102B6F8AD5F9),  -66, false },  // c0
+        { UINT64_C(0xA6AAA65A047F0F3B),  -63, false },  // c1
+        { UINT64_C(0xC9EF50E9C3294CC0),  -64, true  },  // c2
+        { UINT64_C(0x88C3D3F820F41282),  -65, false }   // c3
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  template<>
+  struct minimax_sqrt<64>
+  {
+    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = 4U;
+    BOOST_STATIC_CONSTEXPR int         precision_bits    = 10;
+
+    static const minimax_coefficient* coefficients()
+    {
+      static const minimax_coefficient the_coefficients[coefficient_count] =
+      {
+        { UINT64_C(0xE1A1102B6F8AD5F9),  -66, false },  // c0
+        { UINT64_C(0xA6AAA65A047F0F3B),  -63, false },  // c1
+        { UINT64_C(0xC9EF50E9C3294CC0),  -64, true  },  // c2
+        { UINT64_C(0x88C3D3F820F41282),  -65, false }   // c3
+      };
+
+      return the_coefficients;
+    }
+  };
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_reciprocal.hpp provides the seed tables
+// for the Newton-Raphson iterations of the reciprocal and
+// the reciprocal square root of a normalized mantissa.
+// Each element is the value at the midpoint of its interval,
+// scaled to 15 fractional bits (Q1.15) and rounded to nearest.
+// The relative error of a seed is less than 2^-9.
+
+#ifndef FIXED_POINT_DETAIL_RECIPROCAL_2016_11_16_HPP_
+  #define FIXED_POINT_DETAIL_RECIPROCAL_2016_11_16_HPP_
+
+  #include <cstdint>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  struct reciprocal_seed
+  {
+    // The number of leading bits of the mantissa used as table index.
+    static BOOST_CONSTEXPR_OR_CONST int index_bits = 9;
+
+    // The seed of 1/d, for 1/2 <= d < 1, is indexed by the
+    // leading bits of d minus 256. The table has 256 elements.
+    static std::uint16_t recip(const std::uint_fast16_t index)
+    {
+      static const std::uint16_t the_table[256U] =
+      {
+        UINT16_C(0xFF80), UINT16_C(0xFE82), UINT16_C(0xFD86), UINT16_C(0xFC8C), UINT16_C(0xFB94), UINT16_C(0xFA9E), UINT16_C(0xF9A9), UINT16_C(0xF8B7),
+        UINT16_C(0xF7C6), UINT16_C(0xF6D7), UINT16_C(0xF5EA), UINT16_C(0xF4FF), UINT16_C(0xF415), UINT16_C(0xF32D), UINT16_C(0xF247), UINT16_C(0xF163),
+        UINT16_C(0xF080), UINT16_C(0xEF9F), UINT16_C(0xEEBF), UINT16_C(0xEDE1), UINT16_C(0xED05), UINT16_C(0xEC2A), UINT16_C(0xEB51), UINT16_C(0xEA7A),
+        UINT16_C(0xE9A4), UINT16_C(0xE8CF), UINT16_C(0xE7FC), UINT16_C(0xE72B), UINT16_C(0xE65B), UINT16_C(0xE58C), UINT16_C(0xE4BF), UINT16_C(0xE3F4),
+        UINT16_C(0xE329), UINT16_C(0xE260), UINT16_C(0xE199), UINT16_C(0xE0D3), UINT16_C(0xE00E), UINT16_C(0xDF4B), UINT16_C(0xDE88), UINT16_C(0xDDC8),
+        UINT16_C(0xDD08), UINT16_C(0xDC4A), UINT16_C(0xDB8D), UINT16_C(0xDAD1), UINT16_C(0xDA17), UINT16_C(0xD95E), UINT16_C(0xD8A6), UINT16_C(0xD7EF),
+        UINT16_C(0xD73A), UINT16_C(0xD685), UINT16_C(0xD5D2), UINT16_C(0xD520), UINT16_C(0xD46F), UINT16_C(0xD3BF), UINT16_C(0xD311), UINT16_C(0xD263),
+        UINT16_C(0xD1B7), UINT16_C(0xD10C), UINT16_C(0xD062), UINT16_C(0xCFB9), UINT16_C(0xCF11), UINT16_C(0xCE6A), UINT16_C(0xCDC4), UINT16_C(0xCD1F),
+        UINT16_C(0xCC7B), UINT16_C(0xCBD8), UINT16_C(0xCB36), UINT16_C(0xCA96), UINT16_C(0xC9F6), UINT16_C(0xC957), UINT16_C(0xC8B9), UINT16_C(0xC81C),
+        UINT16_C(0xC780), UINT16_C(0xC6E5), UINT16_C(0xC64B), UINT16_C(0xC5B2), UINT16_C(0xC51A), UINT16_C(0xC482), UINT16_C(0xC3EC), UINT16_C(0xC357),
+        UINT16_C(0xC2C2), UINT16_C(0xC22E), UINT16_C(0xC19B), UINT16_C(0xC109), UINT16_C(0xC078), UINT16_C(0xBFE8), UINT16_C(0xBF59), UINT16_C(0xBECA),
+        UINT16_C(0xBE3C), UINT16_C(0xBDAF), UINT16_C(0xBD23), UINT16_C(0xBC98), UINT16_C(0xBC0D), UINT16_C(0xBB83), UINT16_C(0xBAFB), UINT16_C(0xBA72),
+        UINT16_C(0xB9EB), UINT16_C(0xB964), UINT16_C(0xB8DE), UINT16_C(0xB859), UINT16_C(0xB7D5), UINT16_C(0xB751), UINT16_C(0xB6CE), UINT16_C(0xB64C),
+        UINT16_C(0xB5CB), UINT16_C(0xB54A), UINT16_C(0xB4CA), UINT16_C(0xB44B), UINT16_C(0xB3CC), UINT16_C(0xB34E), UINT16_C(0xB2D1), UINT16_C(0xB254),
+        UINT16_C(0xB1D8), UINT16_C(0xB15D), UINT16_C(0xB0E3), UINT16_C(0xB069), UINT16_C(0xAFF0), UINT16_C(0xAF77), UINT16_C(0xAEFF), UINT16_C(0xAE88),
+        UINT16_C(0xAE11), UINT16_C(0xAD9B), UINT16_C(0xAD26), UINT16_C(0xACB1), UINT16_C(0xAC3D), UINT16_C(0xABC9), UINT16_C(0xAB56), UINT16_C(0xAAE4),
+        UINT16_C(0xAA72), UINT16_C(0xAA01), UINT16_C(0xA990), UINT16_C(0xA920), UINT16_C(0xA8B1), UINT16_C(0xA842), UINT16_C(0xA7D3), UINT16_C(0xA766),
+        UINT16_C(0xA6F8), UINT16_C(0xA68C), UINT16_C(0xA620), UINT16_C(0xA5B4), UINT16_C(0xA549), UINT16_C(0xA4DF), UINT16_C(0xA475), UINT16_C(0xA40C),
+        UINT16_C(0xA3A3), UINT16_C(0xA33A), UINT16_C(0xA2D3), UINT16_C(0xA26B), UINT16_C(0xA204), UINT16_C(0xA19E), UINT16_C(0xA138), UINT16_C(0xA0D3),
+        UINT16_C(0xA06E), UINT16_C(0xA00A), UINT16_C(0x9FA6), UINT16_C(0x9F43), UINT16_C(0x9EE0), UINT16_C(0x9E7E), UINT16_C(0x9E1C), UINT16_C(0x9DBA),
+        UINT16_C(0x9D59), UINT16_C(0x9CF9), UINT16_C(0x9C99), UINT16_C(0x9C39), UINT16_C(0x9BDA), UINT16_C(0x9B7C), UINT16_C(0x9B1D), UINT16_C(0x9AC0),
+        UINT16_C(0x9A62), UINT16_C(0x9A05), UINT16_C(0x99A9), UINT16_C(0x994D), UINT16_C(0x98F1), UINT16_C(0x9896), UINT16_C(0x983B), UINT16_C(0x97E1),
+        UINT16_C(0x9787), UINT16_C(0x972E), UINT16_C(0x96D5), UINT16_C(0x967C), UINT16_C(0x9624), UINT16_C(0x95CC), UINT16_C(0x9574), UINT16_C(0x951D),
+        UINT16_C(0x94C7), UINT16_C(0x9470), UINT16_C(0x941B), UINT16_C(0x93C5), UINT16_C(0x9370), UINT16_C(0x931B), UINT16_C(0x92C7), UINT16_C(0x9273),
+        UINT16_C(0x921F), UINT16_C(0x91CC), UINT16_C(0x9179), UINT16_C(0x9127), UINT16_C(0x90D5), UINT16_C(0x9083), UINT16_C(0x9032), UINT16_C(0x8FE1),
+        UINT16_C(0x8F90), UINT16_C(0x8F40), UINT16_C(0x8EF0), UINT16_C(0x8EA0), UINT16_C(0x8E51), UINT16_C(0x8E02), UINT16_C(0x8DB3), UINT16_C(0x8D65),
+        UINT16_C(0x8D17), UINT16_C(0x8CC9), UINT16_C(0x8C7C), UINT16_C(0x8C2F), UINT16_C(0x8BE2), UINT16_C(0x8B96), UINT16_C(0x8B4A), UINT16_C(0x8AFF),
+        UINT16_C(0x8AB3), UINT16_C(0x8A68), UINT16_C(0x8A1E), UINT16_C(0x89D3), UINT16_C(0x8989), UINT16_C(0x8940), UINT16_C(0x88F6), UINT16_C(0x88AD),
+        UINT16_C(0x8864), UINT16_C(0x881C), UINT16_C(0x87D3), UINT16_C(0x878C), UINT16_C(0x8744), UINT16_C(0x86FD), UINT16_C(0x86B6), UINT16_C(0x866F),
+        UINT16_C(0x8628), UINT16_C(0x85E2), UINT16_C(0x859C), UINT16_C(0x8557), UINT16_C(0x8511), UINT16_C(0x84CC), UINT16_C(0x8488), UINT16_C(0x8443),
+        UINT16_C(0x83FF), UINT16_C(0x83BB), UINT16_C(0x8377), UINT16_C(0x8334), UINT16_C(0x82F1), UINT16_C(0x82AE), UINT16_C(0x826B), UINT16_C(0x8229),
+        UINT16_C(0x81E7), UINT16_C(0x81A5), UINT16_C(0x8164), UINT16_C(0x8123), UINT16_C(0x80E2), UINT16_C(0x80A1), UINT16_C(0x8060), UINT16_C(0x8020)
+      };
+
+      return the_table[index - 256U];
+    }
+
+    // The seed of 1/sqrt(d), for 1/4 <= d < 1, is indexed by the
+    // leading bits of d minus 128. The table has 384 elements.
+    static std::uint16_t rsqrt(const std::uint_fast16_t index)
+    {
+      static const std::uint16_t the_table[384U] =
+      {
+        UINT16_C(0xFF80), UINT16_C(0xFE83), UINT16_C(0xFD89), UINT16_C(0xFC92), UINT16_C(0xFB9E), UINT16_C(0xFAAC), UINT16_C(0xF9BD), UINT16_C(0xF8D0),
+        UINT16_C(0xF7E7), UINT16_C(0xF700), UINT16_C(0xF61B), UINT16_C(0xF539), UINT16_C(0xF459), UINT16_C(0xF37B), UINT16_C(0xF2A0), UINT16_C(0xF1C7),
+        UINT16_C(0xF0F1), UINT16_C(0xF01D), UINT16_C(0xEF4A), UINT16_C(0xEE7A), UINT16_C(0xEDAD), UINT16_C(0xECE1), UINT16_C(0xEC17), UINT16_C(0xEB4F),
+        UINT16_C(0xEA89), UINT16_C(0xE9C5), UINT16_C(0xE903), UINT16_C(0xE843), UINT16_C(0xE785), UINT16_C(0xE6C9), UINT16_C(0xE60E), UINT16_C(0xE555),
+        UINT16_C(0xE49E), UINT16_C(0xE3E8), UINT16_C(0xE335), UINT16_C(0xE282), UINT16_C(0xE1D2), UINT16_C(0xE123), UINT16_C(0xE076), UINT16_C(0xDFCA),
+        UINT16_C(0xDF20), UINT16_C(0xDE77), UINT16_C(0xDDD0), UINT16_C(0xDD2A), UINT16_C(0xDC85), UINT16_C(0xDBE3), UINT16_C(0xDB41), UINT16_C(0xDAA1),
+        UINT16_C(0xDA02), UINT16_C(0xD965), UINT16_C(0xD8C9), UINT16_C(0xD82E), UINT16_C(0xD794), UINT16_C(0xD6FC), UINT16_C(0xD665), UINT16_C(0xD5CF),
+        UINT16_C(0xD53B), UINT16_C(0xD4A7), UINT16_C(0xD415), UINT16_C(0xD384), UINT16_C(0xD2F4), UINT16_C(0xD266), UINT16_C(0xD1D8), UINT16_C(0xD14C),
+        UINT16_C(0xD0C0), UINT16_C(0xD036), UINT16_C(0xCFAD), UINT16_C(0xCF25), UINT16_C(0xCE9E), UINT16_C(0xCE18), UINT16_C(0xCD93), UINT16_C(0xCD0E),
+        UINT16_C(0xCC8B), UINT16_C(0xCC09), UINT16_C(0xCB88), UINT16_C(0xCB08), UINT16_C(0xCA89), UINT16_C(0xCA0A), UINT16_C(0xC98D), UINT16_C(0xC911),
+        UINT16_C(0xC895), UINT16_C(0xC81A), UINT16_C(0xC7A0), UINT16_C(0xC728), UINT16_C(0xC6AF), UINT16_C(0xC638), UINT16_C(0xC5C2), UINT16_C(0xC54C),
+        UINT16_C(0xC4D7), UINT16_C(0xC463), UINT16_C(0xC3F0), UINT16_C(0xC37E), UINT16_C(0xC30C), UINT16_C(0xC29B), UINT16_C(0xC22B), UINT16_C(0xC1BC),
+        UINT16_C(0xC14D), UINT16_C(0xC0E0), UINT16_C(0xC072), UINT16_C(0xC006), UINT16_C(0xBF9A), UINT16_C(0xBF2F), UINT16_C(0xBEC5), UINT16_C(0xBE5B),
+        UINT16_C(0xBDF3), UINT16_C(0xBD8A), UINT16_C(0xBD23), UINT16_C(0xBCBC), UINT16_C(0xBC56), UINT16_C(0xBBF0), UINT16_C(0xBB8B), UINT16_C(0xBB27),
+        UINT16_C(0xBAC3), UINT16_C(0xBA60), UINT16_C(0xB9FD), UINT16_C(0xB99C), UINT16_C(0xB93A), UINT16_C(0xB8DA), UINT16_C(0xB879), UINT16_C(0xB81A),
+        UINT16_C(0xB7BB), UINT16_C(0xB75D), UINT16_C(0xB6FF), UINT16_C(0xB6A2), UINT16_C(0xB645), UINT16_C(0xB5E9), UINT16_C(0xB58D), UINT16_C(0xB532),
+        UINT16_C(0xB4D8), UINT16_C(0xB47E), UINT16_C(0xB424), UINT16_C(0xB3CB), UINT16_C(0xB373), UINT16_C(0xB31B), UINT16_C(0xB2C4), UINT16_C(0xB26D),
+        UINT16_C(0xB216), UINT16_C(0xB1C0), UINT16_C(0xB16B), UINT16_C(0xB116), UINT16_C(0xB0C1), UINT16_C(0xB06D), UINT16_C(0xB01A), UINT16_C(0xAFC7),
+        UINT16_C(0xAF74), UINT16_C(0xAF22), UINT16_C(0xAED0), UINT16_C(0xAE7F), UINT16_C(0xAE2E), UINT16_C(0xADDE), UINT16_C(0xAD8E), UINT16_C(0xAD3E),
+        UINT16_C(0xACEF), UINT16_C(0xACA0), UINT16_C(0xAC52), UINT16_C(0xAC04), UINT16_C(0xABB7), UINT16_C(0xAB6A), UINT16_C(0xAB1D), UINT16_C(0xAAD1),
+        UINT16_C(0xAA85), UINT16_C(0xAA39), UINT16_C(0xA9EE), UINT16_C(0xA9A4), UINT16_C(0xA959), UINT16_C(0xA90F), UINT16_C(0xA8C6), UINT16_C(0xA87D),
+        UINT16_C(0xA834), UINT16_C(0xA7EB), UINT16_C(0xA7A3), UINT16_C(0xA75C), UINT16_C(0xA714), UINT16_C(0xA6CD), UINT16_C(0xA687), UINT16_C(0xA640),
+        UINT16_C(0xA5FA), UINT16_C(0xA5B5), UINT16_C(0xA570), UINT16_C(0xA52B), UINT16_C(0xA4E6), UINT16_C(0xA4A2), UINT16_C(0xA45E), UINT16_C(0xA41A),
+        UINT16_C(0xA3D7), UINT16_C(0xA394), UINT16_C(0xA351), UINT16_C(0xA30F), UINT16_C(0xA2CD), UINT16_C(0xA28B), UINT16_C(0xA24A), UINT16_C(0xA209),
+        UINT16_C(0xA1C8), UINT16_C(0xA188), UINT16_C(0xA148), UINT16_C(0xA108), UINT16_C(0xA0C8), UINT16_C(0xA089), UINT16_C(0xA04A), UINT16_C(0xA00B),
+        UINT16_C(0x9FCD), UINT16_C(0x9F8F), UINT16_C(0x9F51), UINT16_C(0x9F13), UINT16_C(0x9ED6), UINT16_C(0x9E99), UINT16_C(0x9E5C), UINT16_C(0x9E20),
+        UINT16_C(0x9DE4), UINT16_C(0x9DA8), UINT16_C(0x9D6C), UINT16_C(0x9D31), UINT16_C(0x9CF6), UINT16_C(0x9CBB), UINT16_C(0x9C80), UINT16_C(0x9C46),
+        UINT16_C(0x9C0C), UINT16_C(0x9BD2), UINT16_C(0x9B98), UINT16_C(0x9B5F), UINT16_C(0x9B26), UINT16_C(0x9AED), UINT16_C(0x9AB4), UINT16_C(0x9A7C),
+        UINT16_C(0x9A44), UINT16_C(0x9A0C), UINT16_C(0x99D4), UINT16_C(0x999D), UINT16_C(0x9965), UINT16_C(0x992F), UINT16_C(0x98F8), UINT16_C(0x98C1),
+        UINT16_C(0x988B), UINT16_C(0x9855), UINT16_C(0x981F), UINT16_C(0x97EA), UINT16_C(0x97B4), UINT16_C(0x977F), UINT16_C(0x974A), UINT16_C(0x9715),
+        UINT16_C(0x96E1), UINT16_C(0x96AC), UINT16_C(0x9678), UINT16_C(0x9645), UINT16_C(0x9611), UINT16_C(0x95DD), UINT16_C(0x95AA), UINT16_C(0x9577),
+        UINT16_C(0x9544), UINT16_C(0x9512), UINT16_C(0x94DF), UINT16_C(0x94AD), UINT16_C(0x947B), UINT16_C(0x9449), UINT16_C(0x9417), UINT16_C(0x93E6),
+        UINT16_C(0x93B5), UINT16_C(0x9384), UINT16_C(0x9353), UINT16_C(0x9322), UINT16_C(0x92F1), UINT16_C(0x92C1), UINT16_C(0x9291), UINT16_C(0x9261),
+        UINT16_C(0x9231), UINT16_C(0x9202), UINT16_C(0x91D2), UINT16_C(0x91A3), UINT16_C(0x9174), UINT16_C(0x9145), UINT16_C(0x9116), UINT16_C(0x90E8),
+        UINT16_C(0x90BA), UINT16_C(0x908B), UINT16_C(0x905D), UINT16_C(0x9030), UINT16_C(0x9002), UINT16_C(0x8FD4), UINT16_C(0x8FA7), UINT16_C(0x8F7A),
+        UINT16_C(0x8F4D), UINT16_C(0x8F20), UINT16_C(0x8EF4), UINT16_C(0x8EC7), UINT16_C(0x8E9B), UINT16_C(0x8E6F), UINT16_C(0x8E43), UINT16_C(0x8E17),
+        UINT16_C(0x8DEB), UINT16_C(0x8DBF), UINT16_C(0x8D94), UINT16_C(0x8D69), UINT16_C(0x8D3E), UINT16_C(0x8D13), UINT16_C(0x8CE8), UINT16_C(0x8CBD),
+        UINT16_C(0x8C93), UINT16_C(0x8C69), UINT16_C(0x8C3F), UINT16_C(0x8C15), UINT16_C(0x8BEB), UINT16_C(0x8BC1), UINT16_C(0x8B97), UINT16_C(0x8B6E),
+        UINT16_C(0x8B45), UINT16_C(0x8B1C), UINT16_C(0x8AF3), UINT16_C(0x8ACA), UINT16_C(0x8AA1), UINT16_C(0x8A78), UINT16_C(0x8A50), UINT16_C(0x8A28),
+        UINT16_C(0x89FF), UINT16_C(0x89D7), UINT16_C(0x89AF), UINT16_C(0x8988), UINT16_C(0x8960), UINT16_C(0x8939), UINT16_C(0x8911), UINT16_C(0x88EA),
+        UINT16_C(0x88C3), UINT16_C(0x889C), UINT16_C(0x8875), UINT16_C(0x884E), UINT16_C(0x8828), UINT16_C(0x8801), UINT16_C(0x87DB), UINT16_C(0x87B5),
+        UINT16_C(0x878F), UINT16_C(0x8769), UINT16_C(0x8743), UINT16_C(0x871D), UINT16_C(0x86F8), UINT16_C(0x86D2), UINT16_C(0x86AD), UINT16_C(0x8688),
+        UINT16_C(0x8663), UINT16_C(0x863E), UINT16_C(0x8619), UINT16_C(0x85F4), UINT16_C(0x85CF), UINT16_C(0x85AB), UINT16_C(0x8587), UINT16_C(0x8562),
+        UINT16_C(0x853E), UINT16_C(0x851A), UINT16_C(0x84F6), UINT16_C(0x84D2), UINT16_C(0x84AF), UINT16_C(0x848B), UINT16_C(0x8468), UINT16_C(0x8444),
+        UINT16_C(0x8421), UINT16_C(0x83FE), UINT16_C(0x83DB), UINT16_C(0x83B8), UINT16_C(0x8395), UINT16_C(0x8372), UINT16_C(0x8350), UINT16_C(0x832D),
+        UINT16_C(0x830B), UINT16_C(0x82E9), UINT16_C(0x82C6), UINT16_C(0x82A4), UINT16_C(0x8282), UINT16_C(0x8261), UINT16_C(0x823F), UINT16_C(0x821D),
+        UINT16_C(0x81FC), UINT16_C(0x81DA), UINT16_C(0x81B9), UINT16_C(0x8197), UINT16_C(0x8176), UINT16_C(0x8155), UINT16_C(0x8134), UINT16_C(0x8113),
+        UINT16_C(0x80F3), UINT16_C(0x80D2), UINT16_C(0x80B1), UINT16_C(0x8091), UINT16_C(0x8071), UINT16_C(0x8050), UINT16_C(0x8030), UINT16_C(0x8010)
+      };
+
+      return the_table[index - 128U];
+    }
+  };
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_RECIPROCAL_2016_11_16_HPP_
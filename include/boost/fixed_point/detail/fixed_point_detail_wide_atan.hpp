@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_wide_atan.hpp implements the arc tangent,
+// arc sine and arc cosine functions for fractional resolutions
+// beyond the minimax tiers.
+// The argument is halved a few times with
+// atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))) and the short Taylor
+// series of the small halved argument is summed. The calculation
+// runs on unbounded multiprecision integers (see
+// fixed_point_detail_constants_binary_splitting.hpp) with guard bits
+// for the doubling of the error in each halving. Each call therefore
+// takes a bounded number of square roots, divisions and multiplications.
+// The number of halvings has been tuned with
+// example/fixed_point_wide_atan_benchmark.cpp.
+
+#ifndef FIXED_POINT_DETAIL_WIDE_ATAN_2016_11_21_HPP_
+  #define FIXED_POINT_DETAIL_WIDE_ATAN_2016_11_21_HPP_
+
+  #include <cstdint>
+  #include <type_traits>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  #if !defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
+
+    // Select the algorithm for a given fractional resolution.
+    // For all resolutions beyond the minimax tiers, the argument halving
+    // is faster than the Newton iteration of atan on sin and cos and
+    // faster than the square roots of asin and acos on the negatable type.
+    template<const int RadixSplit>
+    struct wide_atan_tier
+    {
+      typedef std::true_type use_argument_halving;
+    };
+
+    // The number of halvings k and the working precision w of the
+    // arc tangent. Doubling the result k times amplifies the error 2^k times.
+    // Each halving needs a square root and a division, whereas each term
+    // of the series needs one multiplication, so only a few halvings pay off.
+    template<const int RadixSplit>
+    struct atan_halving_precision
+    {
+      BOOST_STATIC_CONSTEXPR int k = ((RadixSplit < 512) ? 2 : 4);
+      BOOST_STATIC_CONSTEXPR int w = RadixSplit + k + 8;
+    };
+
+    // Compute atan(y) * 2^w for the argument y / 2^w with 0 <= y < 2^w.
+    inline wide_integer_type atan_halving_series(wide_integer_type y, const int k, const int w)
+    {
+      const wide_integer_type one = wide_integer_type(1U) << w;
+
+      // Halve the argument k times. Thereafter y < tan(pi / 2^(k + 2)).
+      for(int i = 0; i < k; ++i)
+      {
+        const wide_integer_type root = wide_integer_sqrt((one << w) + (y * y));
+
+        y = (y << w) / (one + root);
+      }
+
+      // Sum the Taylor series atan(y) = y - y^3/3 + y^5/5 - ...
+      const wide_integer_type y2 = (y * y) >> w;
+
+      wide_integer_type term = y;
+      wide_integer_type sum  = y;
+
+      for(std::uint32_t n = 1U; ; ++n)
+      {
+        term = (term * y2) >> w;
+
+        if(term == 0)
+        {
+          break;
+        }
+
+        if((n % 2U) != 0U)
+        {
+          sum -= term / ((2U * n) + 1U);
+        }
+        else
+        {
+          sum += term / ((2U * n) + 1U);
+        }
+      }
+
+      return sum << k;
+    }
+
+    // Round v / 2^w to the resolution of NegatableType.
+    template<typename NegatableType>
+    NegatableType atan_halving_round(const wide_integer_type& v, const int w)
+    {
+      typedef typename NegatableType::value_type value_type;
+      typedef typename NegatableType::nothing    nothing;
+
+      const int shift = w - NegatableType::radix_split;
+
+      return NegatableType(nothing(), value_type((v + (wide_integer_type(1U) << (shift - 1))) >> shift));
+    }
+
+    // Compute the representation of atan(x) for 0 < x < 1.
+    template<typename NegatableType>
+    NegatableType atan_argument_halving_kernel(const NegatableType& x)
+    {
+      BOOST_CONSTEXPR_OR_CONST int radix_split = NegatableType::radix_split;
+
+      const int k = atan_halving_precision<radix_split>::k;
+      const int w = atan_halving_precision<radix_split>::w;
+
+      const wide_integer_type y = wide_integer_type(x.crepresentation()) << (w - radix_split);
+
+      return atan_halving_round<NegatableType>(atan_halving_series(y, k, w), w);
+    }
+
+    // Compute the representation of asin(x) or acos(x) for 0 < x < 1.
+    // The argument of atan is at most 1/sqrt(3) in both of the ranges below.
+    template<typename NegatableType>
+    NegatableType asin_acos_argument_halving_kernel(const NegatableType& x, const bool is_acos)
+    {
+      BOOST_CONSTEXPR_OR_CONST int radix_split = NegatableType::radix_split;
+
+      const int k = atan_halving_precision<radix_split>::k;
+      const int w = atan_halving_precision<radix_split>::w;
+
+      const wide_integer_type one     = wide_integer_type(1U) << w;
+      const wide_integer_type u       = wide_integer_type(x.crepresentation()) << (w - radix_split);
+      const wide_integer_type pi_half = wide_constant_representation<constant_pi>(w - 1);
+
+      wide_integer_type result;
+
+      if(u <= (one >> 1))
+      {
+        // Use asin(x) = atan(x / sqrt(1 - x^2)) and acos(x) = pi/2 - asin(x).
+        const wide_integer_type root = wide_integer_sqrt((one << w) - (u * u));
+
+        result = atan_halving_series((u << w) / root, k, w);
+
+        if(is_acos)
+        {
+          result = pi_half - result;
+        }
+      }
+      else
+      {
+        // Use acos(x) = 2 atan(sqrt((1 - x) / (1 + x))) and asin(x) = pi/2 - acos(x).
+        // The quotient is formed with 2w bits, retaining the precision near x = 1.
+        const wide_integer_type y = wide_integer_sqrt(((one - u) << (2 * w)) / (one + u));
+
+        result = atan_halving_series(y, k, w) << 1;
+
+        if(!is_acos)
+        {
+          result = pi_half - result;
+        }
+      }
+
+      return atan_halving_round<NegatableType>(result, w);
+    }
+
+    template<typename NegatableType>
+    NegatableType atan_wide_series(const NegatableType& x, std::true_type)
+    {
+      return atan_argument_halving_kernel(x);
+    }
+
+    template<typename NegatableType>
+    NegatableType asin_wide_series(const NegatableType& x, std::true_type)
+    {
+      return asin_acos_argument_halving_kernel(x, false);
+    }
+
+    template<typename NegatableType>
+    NegatableType acos_wide_series(const NegatableType& x, std::true_type)
+    {
+      return asin_acos_argument_halving_kernel(x, true);
+    }
+
+  #else
+
+    template<const int RadixSplit>
+    struct wide_atan_tier
+    {
+      typedef std::false_type use_argument_halving;
+    };
+
+  #endif // !BOOST_FIXED_POINT_DISABLE_MULTIPRECISION
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_WIDE_ATAN_2016_11_21_HPP_
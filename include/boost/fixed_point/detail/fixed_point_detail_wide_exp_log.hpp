@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+// Distributed under the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// fixed_point_detail_wide_exp_log.hpp implements the exponential
+// function with binary splitting and the logarithm function
+// with the arithmetic-geometric mean (AGM) for very wide
+// fractional resolutions. Both run on unbounded multiprecision
+// integers (see fixed_point_detail_constants_binary_splitting.hpp)
+// with a few guard bits beyond the resolution.
+// They are selected above the resolution thresholds
+// of wide_exp_log_tier, which have been tuned with
+// example/fixed_point_wide_exp_log_benchmark.cpp.
+
+#ifndef FIXED_POINT_DETAIL_WIDE_EXP_LOG_2016_11_18_HPP_
+  #define FIXED_POINT_DETAIL_WIDE_EXP_LOG_2016_11_18_HPP_
+
+  #include <cstdint>
+  #include <type_traits>
+
+  #include <boost/config.hpp>
+
+  namespace boost { namespace fixed_point { namespace detail {
+
+  #if !defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
+
+    // Select the algorithms for a given fractional resolution.
+    // Below the thresholds, the Taylor series of exp and the
+    // Newton iteration of log are faster.
+    template<const int RadixSplit>
+    struct wide_exp_log_tier
+    {
+      BOOST_STATIC_CONSTEXPR int exp_threshold_bits = 720;
+      BOOST_STATIC_CONSTEXPR int log_threshold_bits = 112;
+
+      typedef std::integral_constant<bool, (RadixSplit > exp_threshold_bits)> use_binary_splitting;
+      typedef std::integral_constant<bool, (RadixSplit > log_threshold_bits)> use_agm;
+    };
+
+    // Binary splitting of the Taylor series of exp(x) - 1 for x = p / 2^m,
+    // summing the terms a+1 through b. The sum is T / (Q * 2^(m * (b - a))),
+    // in which P = p^(b - a) and Q = (a + 1) * ... * b.
+    inline void exp_binary_splitting(const wide_integer_type& p,
+                                     const int m,
+                                     const std::uint32_t a,
+                                     const std::uint32_t b,
+                                     wide_integer_type& P,
+                                     wide_integer_type& Q,
+                                     wide_integer_type& T)
+    {
+      if((b - a) == 1U)
+      {
+        P = p;
+        Q = b;
+        T = p;
+      }
+      else
+      {
+        const std::uint32_t c = (a + b) / 2U;
+
+        wide_integer_type P2;
+        wide_integer_type Q2;
+        wide_integer_type T2;
+
+        exp_binary_splitting(p, m, a, c, P,  Q,  T);
+        exp_binary_splitting(p, m, c, b, P2, Q2, T2);
+
+        T  = ((T * Q2) << (m * int(b - c))) + (P * T2);
+        P *= P2;
+        Q *= Q2;
+      }
+    }
+
+    // Compute (exp(x) - 1) * 2^w for x = p / 2^m with |x| < 2^-s.
+    inline wide_integer_type exp_minus_one_binary_splitting(const wide_integer_type& p,
+                                                            const int m,
+                                                            const int s,
+                                                            const int w)
+    {
+      // Find the number of terms n with |x|^n / n! < 2^-(w + 2).
+      std::uint32_t n = 0U;
+
+      for(int bits = 0; bits < (w + 2); )
+      {
+        ++n;
+
+        bits += s + wide_integer_msb(wide_integer_type(n));
+      }
+
+      wide_integer_type P;
+      wide_integer_type Q;
+      wide_integer_type T;
+
+      exp_binary_splitting(p, m, 0U, n, P, Q, T);
+
+      return (T << w) / (Q << (m * int(n)));
+    }
+
+    // Compute the representation of exp(r) for |r| < 1.
+    // The argument is halved k times, with k near sqrt(radix_split).
+    // The halved argument is split into pieces having k, 2k, 4k, ...
+    // bits (the bit-burst method), whose exponentials are computed
+    // with binary splitting and multiplied. The result is squared k times.
+    template<typename NegatableType>
+    NegatableType exp_binary_splitting_kernel(const NegatableType& r)
+    {
+      typedef typename NegatableType::value_type value_type;
+      typedef typename NegatableType::nothing    nothing;
+
+      BOOST_CONSTEXPR_OR_CONST int radix_split = NegatableType::radix_split;
+
+      int k = 1;
+
+      while((k * k) < radix_split)
+      {
+        ++k;
+      }
+
+      // Squaring k times amplifies the error 2^k times.
+      const int w = radix_split + k + 8;
+      const int m = radix_split + k;
+
+      const bool              is_neg = (r.crepresentation() < 0);
+      const wide_integer_type u      = wide_integer_type((!is_neg) ? r.crepresentation() : value_type(-r.crepresentation()));
+
+      const wide_integer_type one = wide_integer_type(1U) << w;
+
+      wide_integer_type e = one;
+
+      // The bits of x = u / 2^m at the positions (lo, hi] below the binary point.
+      for(int lo = k, piece = k; lo < m; lo += piece, piece *= 2)
+      {
+        const int hi = (((lo + piece) < m) ? (lo + piece) : m);
+
+        wide_integer_type p = (u >> (m - hi)) & ((wide_integer_type(1U) << (hi - lo)) - 1U);
+
+        if(p != 0)
+        {
+          if(is_neg)
+          {
+            p = -p;
+          }
+
+          e = (e * (one + exp_minus_one_binary_splitting(p, hi, lo, w))) >> w;
+        }
+      }
+
+      for(int i = 0; i < k; ++i)
+      {
+        e = (e * e) >> w;
+      }
+
+      // Round to the resolution of NegatableType.
+      e = (e + (wide_integer_type(1U) << ((w - radix_split) - 1))) >> (w - radix_split);
+
+      return NegatableType(nothing(), value_type(e));
+    }
+
+    // Compute y / AGM(y, 4) * 2^w for y = u / 2^w.
+    inline wide_integer_type log_agm_term(const wide_integer_type& u, const int w)
+    {
+      wide_integer_type a = u;
+      wide_integer_type b = wide_integer_type(4U) << w;
+
+      for(int i = 0; i < 64; ++i)
+      {
+        const wide_integer_type d = ((a > b) ? wide_integer_type(a - b) : wide_integer_type(b - a));
+
+        if(d <= 8U)
+        {
+          break;
+        }
+
+        const wide_integer_type a_next = (a + b) >> 1;
+
+        b = wide_integer_sqrt(a * b);
+        a = a_next;
+      }
+
+      return (u << w) / a;
+    }
+
+    // The working precision and the exponent m of the argument y = x * 2^m
+    // of the AGM, such that y exceeds 2^(w/2) and log(y) = pi * y / (2 AGM(y, 4))
+    // holds to within 2^-w.
+    template<const int RadixSplit>
+    struct log_agm_precision
+    {
+      BOOST_STATIC_CONSTEXPR int w = RadixSplit + 32;
+      BOOST_STATIC_CONSTEXPR int m = (w / 2) + 4;
+    };
+
+    // The term 2^m / AGM(2^m, 4) is the same for each call. It is computed once.
+    template<const int RadixSplit>
+    const wide_integer_type& log_agm_reference_term()
+    {
+      typedef log_agm_precision<RadixSplit> precision_type;
+
+      static const wide_integer_type reference_term =
+        log_agm_term(wide_integer_type(1U) << (precision_type::w + precision_type::m), precision_type::w);
+
+      return reference_term;
+    }
+
+    // Compute log(x) for 1 < x <= 2 with the AGM. The difference
+    // log(x) = log(x * 2^m) - log(2^m) avoids the multiplication
+    // of ln_two with m, so only pi is needed.
+    template<typename NegatableType>
+    NegatableType log_agm_kernel(const NegatableType& x)
+    {
+      typedef typename NegatableType::value_type value_type;
+      typedef typename NegatableType::nothing    nothing;
+
+      BOOST_CONSTEXPR_OR_CONST int radix_split = NegatableType::radix_split;
+
+      typedef log_agm_precision<radix_split> precision_type;
+
+      const wide_integer_type u = wide_integer_type(x.crepresentation()) << ((precision_type::w - radix_split) + precision_type::m);
+
+      const wide_integer_type d = log_agm_term(u, precision_type::w) - log_agm_reference_term<radix_split>();
+
+      const wide_integer_type pi = wide_integer_type(negatable_constants<NegatableType>::pi().crepresentation());
+
+      // Multiply with pi/2 and round to the resolution of NegatableType.
+      const wide_integer_type result = ((d * pi) + (wide_integer_type(1U) << precision_type::w)) >> (precision_type::w + 1);
+
+      return NegatableType(nothing(), value_type(result));
+    }
+
+    template<typename NegatableType>
+    NegatableType exp_wide_series(const NegatableType& r, std::true_type)
+    {
+      return exp_binary_splitting_kernel(r);
+    }
+
+    template<typename NegatableType>
+    NegatableType log_wide_iteration(const NegatableType& x, std::true_type)
+    {
+      return log_agm_kernel(x);
+    }
+
+  #else
+
+    template<const int RadixSplit>
+    struct wide_exp_log_tier
+    {
+      typedef std::false_type use_binary_splitting;
+      typedef std::false_type use_agm;
+    };
+
+  #endif // !BOOST_FIXED_POINT_DISABLE_MULTIPRECISION
+
+  } } } // namespace boost::fixed_point::detail
+
+#endif // FIXED_POINT_DETAIL_WIDE_EXP_LOG_2016_11_18_HPP_
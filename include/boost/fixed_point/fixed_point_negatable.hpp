@@ -101,6 +101,7 @@
 
   #include <boost/fixed_point/detail/fixed_point_detail.hpp>
   #include <boost/fixed_point/detail/fixed_point_detail_constants.hpp>
+  #include <boost/fixed_point/detail/fixed_point_detail_constants_binary_splitting.hpp>
   #include <boost/fixed_point/fixed_point_overflow.hpp>
   #include <boost/fixed_point/fixed_point_round.hpp>
 
@@ -199,12 +200,19 @@
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> recip(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> rsqrt(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 >= (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp2 (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 >= (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log2 (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log10(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> loga (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> a);
@@ -216,6 +224,8 @@
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> void sincos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c, typename std::enable_if< 24 >= (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> void sincos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
@@ -231,10 +241,15 @@
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> void sinh_cosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tanh (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 11 >= (-FractionalResolution)>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const* = nullptr);
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, typename std::enable_if< 24 <  (-FractionalResolution)>::type const* = nullptr);
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> hypot(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y);
 
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode> negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> copysign  (negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y);
@@ -1165,6 +1180,76 @@
       return *this;
     }
 
+    // For unary operators mul and div of (*this op= integral_constant),
+    // the integral operand is known at compile time. Multiplication and
+    // division by a power of two use shifts. Division by any other
+    // constant uses a multiplication with a compile-time reciprocal
+    // (when this fits in the large unsigned type). The rounding is
+    // identical to that of the run-time integral operators above.
+
+    template<typename IntegralType, const IntegralType N>
+    negatable& operator*=(const std::integral_constant<IntegralType, N>&)
+    {
+      typedef detail::constant_magnitude<IntegralType, N> magnitude_type;
+
+      // Avoid the promotion of narrow unsigned types to signed int.
+      typedef typename std::conditional<(std::numeric_limits<unsigned_small_type>::digits < std::numeric_limits<unsigned int>::digits),
+                                        unsigned int,
+                                        unsigned_small_type>::type multiply_type;
+
+      BOOST_CONSTEXPR_OR_CONST bool use_shift = (   magnitude_type::is_power_of_two
+                                                 && (magnitude_type::power_of_two_shift < std::numeric_limits<unsigned_small_type>::digits));
+
+      const bool u_is_neg = (data < 0);
+
+      unsigned_small_type result((!u_is_neg) ? unsigned_small_type(data) : unsigned_small_type(-data));
+
+      result = (result << extra_rounding_bits);
+
+      result = (use_shift ? unsigned_small_type(multiply_type(result) << (use_shift ? magnitude_type::power_of_two_shift : 0))
+                          : unsigned_small_type(multiply_type(result) * multiply_type(magnitude_type::value)));
+
+      // Round the result of the multiplication.
+      const std::int_fast8_t rounding_result = binary_round(result);
+
+      result = unsigned_small_type(value_type(result) + rounding_result);
+
+      // Load the fixed-point result (and account for potentially signed values).
+      data = value_type((u_is_neg == magnitude_type::is_neg) ? value_type(result) : -value_type(result));
+
+      return *this;
+    }
+
+    template<typename IntegralType, const IntegralType N>
+    negatable& operator/=(const std::integral_constant<IntegralType, N>&)
+    {
+      typedef detail::constant_magnitude<IntegralType, N> magnitude_type;
+
+      #if !defined(BOOST_FIXED_POINT_DISABLE_WIDE_INTEGER_MATH)
+      typedef detail::constant_divide_helper<unsigned_small_type, unsigned_large_type, magnitude_type::value> divide_helper_type;
+      #else
+      typedef detail::constant_divide_helper<unsigned_small_type, unsigned_small_type, magnitude_type::value> divide_helper_type;
+      #endif
+
+      const bool u_is_neg = (data < 0);
+
+      unsigned_small_type result((!u_is_neg) ? unsigned_small_type(data) : unsigned_small_type(-data));
+
+      result = (result << extra_rounding_bits);
+
+      result = divide_helper_type::divide(result);
+
+      // Round the result of the division.
+      const std::int_fast8_t rounding_result = binary_round(result);
+
+      result = unsigned_small_type(value_type(result) + rounding_result);
+
+      // Load the fixed-point result (and account for potentially signed values).
+      data = value_type((u_is_neg == magnitude_type::is_neg) ? value_type(result) : -value_type(result));
+
+      return *this;
+    }
+
     /*! Cast operators for built-in signed and unsigned integral types.\n
 
      Note: Cast from @c negatable to a built-in integral type truncates
@@ -1538,127 +1623,192 @@
       return negatable(nothing(), value_type(2));
     }
 
-    #if defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
+    /*! Return the representation of the mathematical constant sqrt(2).\n
+    */
+    static negatable value_root_two()
+    {
+      return root_two_helper<std::uint32_t(-resolution)>::calculate_root_two();
+    }
 
-      /*! Return the representation of the mathematical constant sqrt(2).\n
-      */
-      static negatable value_root_two()
-      {
-        return root_two_helper<std::uint32_t(-resolution)>::calculate_root_two();
-      }
+    /*! Return the representation of the mathematical constant pi.\n
+    */
+    static negatable value_pi()
+    {
+      return pi_helper<std::uint32_t(-resolution)>::calculate_pi();
+    }
 
-      /*! Return the representation of the mathematical constant pi.\n
-      */
-      static negatable value_pi()
-      {
-        return pi_helper<std::uint32_t(-resolution)>::calculate_pi();
-      }
+    /*! Return the representation of the mathematical constant pi/2.\n
+    */
+    static negatable value_pi_half()
+    {
+      return pi_half_helper<std::uint32_t(-resolution)>::calculate_pi_half();
+    }
 
-      /*! Return the representation of the mathematical constant pi/2.\n
-      */
-      static negatable value_pi_half()
-      {
-        return pi_half_helper<std::uint32_t(-resolution)>::calculate_pi_half();
-      }
+    /*! Return the representation of the mathematical constant log(2).\n
+    */
+    static negatable value_ln_two()
+    {
+      return ln_two_helper<std::uint32_t(-resolution)>::calculate_ln_two();
+    }
 
-      /*! Return the representation of the mathematical constant log(2).\n
-      */
-      static negatable value_ln_two()
-      {
-        return ln_two_helper<std::uint32_t(-resolution)>::calculate_ln_two();
-      }
+    /*! Return the representation of the mathematical constant e.\n
+    */
+    static negatable value_e()
+    {
+      return e_helper<std::uint32_t(-resolution)>::calculate_e();
+    }
 
-      /*! Return the representation of the mathematical constant e.\n
-      */
-      static negatable value_e()
-      {
-        return e_helper<std::uint32_t(-resolution)>::calculate_e();
-      }
+    /*! Return the representation of the mathematical constant log(10).\n
+    */
+    static negatable value_ln_ten()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_ln_ten, std::uint32_t(-resolution)>::calculate();
+    }
 
-      /*! Return the bit mask of all bits in the resolution.\n
-      */
-      static unsigned_small_type radix_split_mask()
-      {
-        return unsigned_small_type(unsigned_small_type(negatable(1U).data) - 1U);
-      }
+    /*! Return the representation of the mathematical constant 1/log(2).\n
+    */
+    static negatable value_inv_ln_two()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_inv_ln_two, std::uint32_t(-resolution)>::calculate();
+    }
 
-    #else
+    /*! Return the representation of the mathematical constant 1/log(10).\n
+    */
+    static negatable value_inv_ln_ten()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_inv_ln_ten, std::uint32_t(-resolution)>::calculate();
+    }
 
-      /*! Compute (during pre-main static initialization) the representation of the mathematical constant sqrt(2).\n
-      */
-      static const negatable& value_root_two()
-      {
-        initialization_helper.force_premain_init_of_static_constants();
+    /*! Return the representation of the mathematical constant 2/pi.\n
+    */
+    static negatable value_two_over_pi()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_two_over_pi, std::uint32_t(-resolution)>::calculate();
+    }
 
-        static const negatable the_value_root_two = root_two_helper<std::uint32_t(-resolution)>::calculate_root_two();
+    /*! Return the representation of the mathematical constant pi/4.\n
+    */
+    static negatable value_pi_quarter()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_pi_quarter, std::uint32_t(-resolution)>::calculate();
+    }
 
-        return the_value_root_two;
-      }
+    /*! Return the representation of the mathematical constant 1/pi.\n
+    */
+    static negatable value_inv_pi()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_inv_pi, std::uint32_t(-resolution)>::calculate();
+    }
 
-      /*! Compute (during pre-main static initialization) the representation of the mathematical constant pi.\n
-      */
-      static const negatable& value_pi()
-      {
-        initialization_helper.force_premain_init_of_static_constants();
+    /*! Return the representation of the mathematical constant sqrt(pi).\n
+    */
+    static negatable value_sqrt_pi()
+    {
+      return constant_helper<boost::fixed_point::detail::constant_digits_sqrt_pi, std::uint32_t(-resolution)>::calculate();
+    }
 
-        static const negatable the_value_pi = pi_helper<std::uint32_t(-resolution)>::calculate_pi();
+    /*! Return the bit mask of all bits in the resolution.\n
+    */
+    static unsigned_small_type radix_split_mask()
+    {
+      return unsigned_small_type(unsigned_small_type(negatable(1U).data) - 1U);
+    }
 
-        return the_value_pi;
-      }
+    // The constants are obtained in three tiers of the resolution.
+    //   * Up to 61 (or 62, 63) bits, they are shifted 64-bit literal values.
+    //   * Up to the width of the tables in detail/fixed_point_detail_constants.hpp,
+    //     they are assembled from the table and rounded to nearest.
+    //   * Wider constants are computed with binary splitting
+    //     once, on first use. This tier needs multiprecision.
+    // None of these tiers uses static initialization before main.
 
-      /*! Compute (during pre-main static initialization) the representation of the mathematical constant pi/2.\n
-      */
-      static const negatable& value_pi_half()
-      {
-        initialization_helper.force_premain_init_of_static_constants();
+    template<const std::uint32_t BitCount>
+    static negatable constant_from_table(const std::uint32_t integer_part, const std::uint32_t* fraction_words)
+    {
+      return negatable(nothing(), value_type(boost::fixed_point::detail::constant_from_fraction_words<unsigned_small_type>(integer_part, fraction_words, int(BitCount))));
+    }
 
-        static const negatable the_value_pi_half = value_pi() / 2;
+    #if defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
 
-        return the_value_pi_half;
-      }
+      // Without multiprecision, the width of negatable is limited
+      // to 64 bits and the tables suffice for all constants.
+      template<const std::uint32_t BitCount, typename EnableType = void> struct root_two_helper;
+      template<const std::uint32_t BitCount, typename EnableType = void> struct pi_helper;
+      template<const std::uint32_t BitCount, typename EnableType = void> struct pi_half_helper;
+      template<const std::uint32_t BitCount, typename EnableType = void> struct ln_two_helper;
+      template<const std::uint32_t BitCount, typename EnableType = void> struct e_helper;
 
-      /*! Compute (during pre-main static initialization) the representation of the mathematical constant log(2).\n
-      */
-      static const negatable& value_ln_two()
-      {
-        initialization_helper.force_premain_init_of_static_constants();
+    #else
 
-        static const negatable the_value_ln_two = ln_two_helper<std::uint32_t(-resolution)>::calculate_ln_two();
+      template<const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct root_two_helper
+      {
+        static negatable calculate_root_two()
+        {
+          static const negatable the_value_root_two(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::constant_root_two>(int(BitCount))));
 
-        return the_value_ln_two;
-      }
+          return the_value_root_two;
+        }
+      };
 
-      /*! Compute (during pre-main static initialization) the representation of the mathematical constant e.\n
-      */
-      static const negatable& value_e()
+      template<const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct pi_helper
       {
-        initialization_helper.force_premain_init_of_static_constants();
+        static negatable calculate_pi()
+        {
+          static const negatable the_value_pi(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::constant_pi>(int(BitCount))));
 
-        static const negatable the_value_e = e_helper<std::uint32_t(-resolution)>::calculate_e();
+          return the_value_pi;
+        }
+      };
 
-        return the_value_e;
-      }
+      template<const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct pi_half_helper
+      {
+        static negatable calculate_pi_half()
+        {
+          static const negatable the_value_pi_half(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::constant_pi>(int(BitCount) - 1)));
 
-      /*! Compute (during pre-main static initialization) the bit mask of all bits in the resolution.\n
-      */
-      static const unsigned_small_type& radix_split_mask()
+          return the_value_pi_half;
+        }
+      };
+
+      template<const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct ln_two_helper
       {
-        initialization_helper.force_premain_init_of_static_constants();
+        static negatable calculate_ln_two()
+        {
+          static const negatable the_value_ln_two(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::constant_ln_two>(int(BitCount))));
 
-        static const unsigned_small_type the_value_radix_split_mask(unsigned_small_type(negatable(1U).data) - 1U);
+          return the_value_ln_two;
+        }
+      };
 
-        return the_value_radix_split_mask;
-      }
+      template<const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct e_helper
+      {
+        static negatable calculate_e()
+        {
+          static const negatable the_value_e(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::constant_e>(int(BitCount))));
+
+          return the_value_e;
+        }
+      };
 
     #endif
 
-    template<const std::uint32_t BitCount,
-             typename EnableType = void>
-    struct root_two_helper
+    template<const std::uint32_t BitCount>
+    struct root_two_helper<BitCount,
+                           typename std::enable_if<(BitCount >= 63U) && (BitCount < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
     {
       static negatable calculate_root_two()
       {
-        return negatable(boost::fixed_point::detail::calculate_root_two<float_type>());
+        return constant_from_table<BitCount>(1U, boost::fixed_point::detail::root_two_fraction_words());
       }
     };
 
@@ -1672,13 +1822,14 @@
       }
     };
 
-    template<const std::uint32_t BitCount,
-             typename EnableType = void>
-    struct pi_helper
+    // The representation of pi with BitCount bits is that of pi/2 with BitCount + 1 bits.
+    template<const std::uint32_t BitCount>
+    struct pi_helper<BitCount,
+                     typename std::enable_if<(BitCount >= 62U) && ((BitCount + 1U) < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
     {
       static negatable calculate_pi()
       {
-        return negatable(boost::fixed_point::detail::calculate_pi<float_type>());
+        return constant_from_table<BitCount + 1U>(1U, boost::fixed_point::detail::pi_half_fraction_words());
       }
     };
 
@@ -1692,13 +1843,13 @@
       }
     };
 
-    template<const std::uint32_t BitCount,
-             typename EnableType = void>
-    struct pi_half_helper
+    template<const std::uint32_t BitCount>
+    struct pi_half_helper<BitCount,
+                          typename std::enable_if<(BitCount >= 62U) && (BitCount < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
     {
       static negatable calculate_pi_half()
       {
-        return negatable(boost::fixed_point::detail::calculate_pi<float_type>() / 2);
+        return constant_from_table<BitCount>(1U, boost::fixed_point::detail::pi_half_fraction_words());
       }
     };
 
@@ -1712,13 +1863,13 @@
       }
     };
 
-    template<const std::uint32_t BitCount,
-             typename EnableType = void>
-    struct ln_two_helper
+    template<const std::uint32_t BitCount>
+    struct ln_two_helper<BitCount,
+                         typename std::enable_if<(BitCount >= UINT32_C(64)) && (BitCount < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
     {
       static negatable calculate_ln_two()
       {
-        return negatable(boost::fixed_point::detail::calculate_ln_two<float_type>());
+        return constant_from_table<BitCount>(0U, boost::fixed_point::detail::ln_two_fraction_words());
       }
     };
 
@@ -1732,13 +1883,13 @@
       }
     };
 
-    template<const std::uint32_t BitCount,
-             typename EnableType = void>
-    struct e_helper
+    template<const std::uint32_t BitCount>
+    struct e_helper<BitCount,
+                    typename std::enable_if<(BitCount >= 62U) && (BitCount < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
     {
       static negatable calculate_e()
       {
-        return negatable(boost::fixed_point::detail::calculate_e<float_type>());
+        return constant_from_table<BitCount>(2U, boost::fixed_point::detail::e_fraction_words());
       }
     };
 
@@ -1752,47 +1903,58 @@
       }
     };
 
-    friend class std::numeric_limits<negatable>;
+    // The further constants are obtained in the same three tiers from
+    // the descriptions in detail/fixed_point_detail_constants.hpp.
+    #if defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
 
-    friend struct negatable_constants<negatable>;
+      template<typename DigitsType, const std::uint32_t BitCount, typename EnableType = void> struct constant_helper;
 
-    friend struct initializer;
+    #else
 
-    struct initializer final
-    {
-      initializer()
+      template<typename DigitsType,
+               const std::uint32_t BitCount,
+               typename EnableType = void>
+      struct constant_helper
       {
-        #if defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
-
-          // Multiprecision back-ends are disabled. In this case,
-          // the initialization structure does not initialize
-          // any static constants before the jump to main
-          // because the constants are derived from constexpr
-          // literal values.
-
-        #else
+        static negatable calculate()
+        {
+          static const negatable the_value(nothing(), value_type(boost::fixed_point::detail::wide_constant_representation<boost::fixed_point::detail::wide_constant<DigitsType>>(int(BitCount))));
 
-          // Multiprecision back-ends are enabled. In this case,
-          // the initialization structure does initialize
-          // static constants before the jump to main in order
-          // to reduce the work of initialization to one time.
+          return the_value;
+        }
+      };
 
-          static_cast<void>(negatable::value_root_two());
-          static_cast<void>(negatable::value_pi());
-          static_cast<void>(negatable::value_pi_half());
-          static_cast<void>(negatable::value_ln_two());
-          static_cast<void>(negatable::value_e());
-          static_cast<void>(negatable::radix_split_mask());
+    #endif
 
-        #endif
+    template<typename DigitsType,
+             const std::uint32_t BitCount>
+    struct constant_helper<DigitsType,
+                           BitCount,
+                           typename std::enable_if<(BitCount >= 62U) && (BitCount < std::uint32_t(boost::fixed_point::detail::constant_fraction_table_bits))>::type>
+    {
+      static negatable calculate()
+      {
+        return constant_from_table<static_cast<std::uint32_t>(int(BitCount) + DigitsType::table_shift)>(DigitsType::integer_part, DigitsType::fraction_words());
       }
+    };
 
-      void force_premain_init_of_static_constants() { }
+    template<typename DigitsType,
+             const std::uint32_t BitCount>
+    struct constant_helper<DigitsType,
+                           BitCount,
+                           typename std::enable_if<(BitCount < 62U)>::type>
+    {
+      BOOST_STATIC_CONSTEXPR negatable calculate() BOOST_NOEXCEPT
+      {
+        return negatable(nothing(), value_type(DigitsType::literal >> (61 - int(BitCount))));
+      }
     };
 
-    //! \cond DETAIL
+    friend class std::numeric_limits<negatable>;
+
+    friend struct negatable_constants<negatable>;
 
-    static initializer initialization_helper;
+    //! \cond DETAIL
 
     // Do not document the implementation details unless macro DETAIL is defined.
 
@@ -1919,12 +2081,19 @@
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> sqrt (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> sqrt (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> sqrt (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> exp  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> exp  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> recip(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> rsqrt(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> exp  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 >= (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> exp  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> expm1(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> expm1(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> expm1(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> exp2 (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 >= (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log1p(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log1p(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log1p(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log2 (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> log10(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> pow  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> a);
@@ -1935,6 +2104,8 @@
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> cos  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> cos  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> cos  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> void sincos(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* s, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* c, typename std::enable_if< 24 >= (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> void sincos(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* s, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* c, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> tan  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> tan  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> tan  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
@@ -1950,10 +2121,15 @@
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> atan2(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> y, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> sinh (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> cosh (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> void sinh_cosh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* s, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2>* c);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> tanh (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> asinh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> asinh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> asinh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> asinh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> acosh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
-    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> atanh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> atanh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 11 >= (-FractionalResolution2)>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> atanh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if<(24 >= (-FractionalResolution2)) && (11 < (-FractionalResolution2))>::type const*);
+    template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> atanh(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, typename std::enable_if< 24 <  (-FractionalResolution2)>::type const*);
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> hypot(negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> y);
 
     template<const int IntegralRange2, const int FractionalResolution2, typename RoundMode2, typename OverflowMode2> negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> copysign  (negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> x, negatable<IntegralRange2, FractionalResolution2, RoundMode2, OverflowMode2> y);
@@ -1979,11 +2155,6 @@
 
   #endif // !BOOST_NO_INCLASS_MEMBER_INITIALIZATION
 
-  //! \cond DETAIL
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  typename negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>::initializer negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>::initialization_helper;
-  //! \endcond
-
   template<const int IntegralRange, const int FractionalResolution>
   struct negatable_constants<negatable<IntegralRange, FractionalResolution, round::fastest, overflow::undefined>>
   {
@@ -1991,11 +2162,18 @@
     typedef negatable<IntegralRange, FractionalResolution, round::fastest, overflow::undefined> local_negatable_type;
 
   public:
-    BOOST_STATIC_CONSTEXPR local_negatable_type root_two() { return local_negatable_type::value_root_two(); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi      () { return local_negatable_type::value_pi      (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half () { return local_negatable_type::value_pi_half (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two  () { return local_negatable_type::value_ln_two  (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type e       () { return local_negatable_type::value_e       (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type root_two   () { return local_negatable_type::value_root_two   (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi         () { return local_negatable_type::value_pi         (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half    () { return local_negatable_type::value_pi_half    (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two     () { return local_negatable_type::value_ln_two     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type e          () { return local_negatable_type::value_e          (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_ten     () { return local_negatable_type::value_ln_ten     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_two () { return local_negatable_type::value_inv_ln_two (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_ten () { return local_negatable_type::value_inv_ln_ten (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type two_over_pi() { return local_negatable_type::value_two_over_pi(); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_quarter () { return local_negatable_type::value_pi_quarter (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_pi     () { return local_negatable_type::value_inv_pi     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type sqrt_pi    () { return local_negatable_type::value_sqrt_pi    (); }
   };
 
   template<const int IntegralRange, const int FractionalResolution>
@@ -2005,11 +2183,18 @@
     typedef negatable<IntegralRange, FractionalResolution, round::nearest_even, overflow::undefined> local_negatable_type;
 
   public:
-    BOOST_STATIC_CONSTEXPR local_negatable_type root_two() { return local_negatable_type::value_root_two(); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi      () { return local_negatable_type::value_pi      (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half () { return local_negatable_type::value_pi_half (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two  () { return local_negatable_type::value_ln_two  (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type e       () { return local_negatable_type::value_e       (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type root_two   () { return local_negatable_type::value_root_two   (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi         () { return local_negatable_type::value_pi         (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half    () { return local_negatable_type::value_pi_half    (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two     () { return local_negatable_type::value_ln_two     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type e          () { return local_negatable_type::value_e          (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_ten     () { return local_negatable_type::value_ln_ten     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_two () { return local_negatable_type::value_inv_ln_two (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_ten () { return local_negatable_type::value_inv_ln_ten (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type two_over_pi() { return local_negatable_type::value_two_over_pi(); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_quarter () { return local_negatable_type::value_pi_quarter (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_pi     () { return local_negatable_type::value_inv_pi     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type sqrt_pi    () { return local_negatable_type::value_sqrt_pi    (); }
   };
 
   template<const int IntegralRange, const int FractionalResolution>
@@ -2019,11 +2204,18 @@
     typedef negatable<IntegralRange, FractionalResolution, round::classic, overflow::undefined> local_negatable_type;
 
   public:
-    BOOST_STATIC_CONSTEXPR local_negatable_type root_two() { return local_negatable_type::value_root_two(); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi      () { return local_negatable_type::value_pi      (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half () { return local_negatable_type::value_pi_half (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two  () { return local_negatable_type::value_ln_two  (); }
-    BOOST_STATIC_CONSTEXPR local_negatable_type e       () { return local_negatable_type::value_e       (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type root_two   () { return local_negatable_type::value_root_two   (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi         () { return local_negatable_type::value_pi         (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_half    () { return local_negatable_type::value_pi_half    (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_two     () { return local_negatable_type::value_ln_two     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type e          () { return local_negatable_type::value_e          (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type ln_ten     () { return local_negatable_type::value_ln_ten     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_two () { return local_negatable_type::value_inv_ln_two (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_ln_ten () { return local_negatable_type::value_inv_ln_ten (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type two_over_pi() { return local_negatable_type::value_two_over_pi(); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type pi_quarter () { return local_negatable_type::value_pi_quarter (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type inv_pi     () { return local_negatable_type::value_inv_pi     (); }
+    BOOST_STATIC_CONSTEXPR local_negatable_type sqrt_pi    () { return local_negatable_type::value_sqrt_pi    (); }
   };
 
   //! \cond DETAIL
@@ -2101,6 +2293,35 @@
     return negatable_type(u) /= v;
   }
 
+  // Implementations of non-member binary mul, div of (negatable op integral_constant)
+  // and non-member binary mul of (integral_constant op negatable).
+  template<typename IntegralType, const IntegralType N,
+           const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> operator*(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& u, const std::integral_constant<IntegralType, N>& v)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> negatable_type;
+
+    return negatable_type(u) *= v;
+  }
+
+  template<typename IntegralType, const IntegralType N,
+           const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> operator/(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& u, const std::integral_constant<IntegralType, N>& v)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> negatable_type;
+
+    return negatable_type(u) /= v;
+  }
+
+  template<typename IntegralType, const IntegralType N,
+           const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> operator*(const std::integral_constant<IntegralType, N>& u, const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& v)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> negatable_type;
+
+    return negatable_type(v) *= u;
+  }
+
   //! Implementations of non-member mixed-math binary add, sub, mul, div of (any_negatable op any_other_negatable).
   //! This includes non-member binary add, sub, mul, div of (negatable op negatable).
   template <const int IntegralRange1, const int FractionalResolution1,
@@ -2345,8 +2566,43 @@
 // transcendental <cmath> functions.
 #include <boost/fixed_point/detail/fixed_point_detail_hypergeometric.hpp>
 
+// Here we include the reduction of trigonometric arguments modulo pi/2.
+#include <boost/fixed_point/detail/fixed_point_detail_argument_reduction.hpp>
+
+// Here we include the coefficients of minimax polynomial approximations
+// of elementary functions for fractional resolutions beyond 24 bits.
+#include <boost/fixed_point/detail/fixed_point_detail_minimax.hpp>
+
+// Here we include the seed tables of the reciprocal and the reciprocal square root.
+#include <boost/fixed_point/detail/fixed_point_detail_reciprocal.hpp>
+
+// Here we include the binary-splitting exp and the AGM-based log for very wide resolutions.
+#include <boost/fixed_point/detail/fixed_point_detail_wide_exp_log.hpp>
+
+// Here we include the arc tangent with argument halving for very wide resolutions.
+#include <boost/fixed_point/detail/fixed_point_detail_wide_atan.hpp>
+
+// Here we include shift-and-subtract implementations (digit recurrences) of functions.
+// These precede the <cmath> functions, which use shift::sqrt.
+#include <boost/fixed_point/fixed_point_negatable_shift.hpp>
+
 // Here we include headers for negatable <cmath> functions.
 #include <boost/fixed_point/fixed_point_negatable_cmath.hpp>
 
+// Here we include batch versions of negatable <cmath> functions.
+#include <boost/fixed_point/fixed_point_negatable_batch.hpp>
+
+// Here we include CORDIC versions of negatable trigonometric and hyperbolic functions.
+#include <boost/fixed_point/fixed_point_negatable_cordic.hpp>
+
+// Here we include table-based versions of negatable elementary functions.
+#include <boost/fixed_point/fixed_point_negatable_lut.hpp>
+
+// Here we include the fast and accurate policies of negatable elementary functions.
+#include <boost/fixed_point/fixed_point_negatable_policy.hpp>
+
 // Here we include headers for negatable <cmath> functions.
 #include <boost/fixed_point/fixed_point_negatable_next.hpp>
+
+// Here we include the compile-time bit-growth analysis for negatable expressions.
+#include <boost/fixed_point/fixed_point_negatable_bit_growth.hpp>
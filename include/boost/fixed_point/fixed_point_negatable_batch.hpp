@@ -0,0 +1,370 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2013 - 2016.
+//  Copyright Nikhar Agrawal 2015.
+//  Copyright Paul Bristow 2015.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief Batch versions of fixed_point negatable <cmath> functions operating on arrays.
+  \details Each batch function evaluates its scalar counterpart element-by-element
+    over an input array and stores the results in an output array.
+    The results are bit-identical to those of the scalar functions.
+    The exceptions are atan2 and magnitude of in-phase and quadrature
+    (IQ) sample arrays, which use CORDIC vectoring on blocks of samples.
+    The input and output arrays may be the same array (in-place evaluation),
+    but they must not otherwise overlap.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_BATCH_2016_11_07_HPP_
+  #define FIXED_POINT_NEGATABLE_BATCH_2016_11_07_HPP_
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  #include <boost/fixed_point/detail/fixed_point_detail_cordic.hpp>
+
+  namespace boost { namespace fixed_point { namespace batch {
+
+  namespace detail {
+
+  // Apply the unary scalar function to each element of the input array.
+  // The loop is unrolled by four in order to give the compiler
+  // independent chains of instructions to schedule.
+  template<typename NegatableType, typename UnaryFunctionType>
+  void transform(const NegatableType* in, NegatableType* out, const std::size_t count, UnaryFunctionType function)
+  {
+    static_assert(is_fixed_point<NegatableType>::value,
+                  "Error: The batch functions can only be instantiated with a fixed-point negatable type.");
+
+    std::size_t i = 0U;
+
+    for( ; (i + 4U) <= count; i += 4U)
+    {
+      const NegatableType x0 = in[i + 0U];
+      const NegatableType x1 = in[i + 1U];
+      const NegatableType x2 = in[i + 2U];
+      const NegatableType x3 = in[i + 3U];
+
+      out[i + 0U] = function(x0);
+      out[i + 1U] = function(x1);
+      out[i + 2U] = function(x2);
+      out[i + 3U] = function(x3);
+    }
+
+    for( ; i < count; ++i)
+    {
+      out[i] = function(in[i]);
+    }
+  }
+
+  // Collect the working type and the number of iterations of the CORDIC
+  // vectoring of IQ samples. The samples are normalized, so that the larger
+  // component has its most significant bit just below the working fractional bits.
+  // A 32-bit working type suffices if the needed precision is 24 bits or less.
+  template<typename NegatableType, const bool IsAngle>
+  struct iq_vector_helper
+  {
+    static_assert(NegatableType::all_bits <= 32,
+                  "Error: The batch IQ functions can only be instantiated with a negatable type having 32 bits or less.");
+
+    BOOST_STATIC_CONSTEXPR bool is_narrow = (IsAngle ? (NegatableType::radix_split <= 24) : (NegatableType::all_bits <= 24));
+
+    typedef typename std::conditional<is_narrow, std::int32_t, std::int64_t>::type work_type;
+
+    // Two bits of headroom hold the CORDIC gain of the normalized vector.
+    BOOST_STATIC_CONSTEXPR int work_bits = std::numeric_limits<work_type>::digits - 2;
+
+    // The residual angle after n iterations is about 2^-n. The magnitude
+    // depends on the square of the residual angle and needs only half
+    // as many iterations as the angle.
+    BOOST_STATIC_CONSTEXPR int iterations = (IsAngle ? (NegatableType::radix_split + 3) : ((NegatableType::all_bits / 2) + 3));
+
+    typedef boost::fixed_point::detail::cordic_table<work_type, work_bits> table_type;
+
+    // Samples are processed in blocks. Within a block, each iteration
+    // is carried out for all samples before the next iteration, giving
+    // the compiler a branch-free inner loop that it can vectorize.
+    BOOST_STATIC_CONSTEXPR std::size_t block_size = 16U;
+
+    // Scale the normalized 32-bit component to the working type.
+    // The multiplier is 2^32, or the inverse CORDIC gain scaled by 2^32.
+    static work_type to_work(const std::uint32_t a, const std::uint64_t multiplier)
+    {
+      return work_type((std::uint64_t(a) * multiplier) >> (64 - work_bits));
+    }
+  };
+
+  // Take the magnitude of a raw representation as an unsigned 32-bit value.
+  template<typename ValueType>
+  std::uint32_t iq_magnitude_of(const ValueType& x)
+  {
+    return ((x < 0) ? std::uint32_t(std::uint32_t(0U) - std::uint32_t(x)) : std::uint32_t(x));
+  }
+
+  // Load the samples (x, y) of a block, reduced to the first octant
+  // and normalized to the working type. The octant and the
+  // normalizing left-shift of each sample are stored for later use.
+  // A partial block is padded with zeros.
+  template<typename HelperType, typename NegatableType>
+  void iq_vector_load(const NegatableType*          in_x,
+                      const NegatableType*          in_y,
+                      const std::size_t             n,
+                      const std::uint64_t           multiplier,
+                      typename HelperType::work_type* u,
+                      typename HelperType::work_type* v,
+                      typename HelperType::work_type* z,
+                      bool*                         is_swapped,
+                      int*                          shift)
+  {
+    for(std::size_t k = 0U; k < n; ++k)
+    {
+      const std::uint32_t ax = iq_magnitude_of(in_x[k].crepresentation());
+      const std::uint32_t ay = iq_magnitude_of(in_y[k].crepresentation());
+
+      is_swapped[k] = (ay > ax);
+
+      std::uint32_t a = (is_swapped[k] ? ay : ax);
+      std::uint32_t b = (is_swapped[k] ? ax : ay);
+
+      std::uint32_t a_msb  = a;
+      std::uint32_t a_mask = (std::numeric_limits<std::uint32_t>::max)();
+
+      shift[k] = 31 - int(boost::fixed_point::detail::msb_helper(a_msb, a_mask, std::uint_fast16_t(32U)));
+
+      a <<= shift[k];
+      b <<= shift[k];
+
+      u[k] = HelperType::to_work(a, multiplier);
+      v[k] = HelperType::to_work(b, multiplier);
+      z[k] = typename HelperType::work_type(0);
+    }
+
+    for(std::size_t k = n; k < HelperType::block_size; ++k)
+    {
+      u[k] = typename HelperType::work_type(0);
+      v[k] = typename HelperType::work_type(0);
+      z[k] = typename HelperType::work_type(0);
+    }
+  }
+
+  // Vectoring mode in circular coordinates on a block of samples with x > 0: drive y to zero.
+  // This is the arithmetic of detail::cordic_circular_vector, with the conditional
+  // statements replaced by the sign mask of y. The sign of y is unpredictable,
+  // and the inner loop over the block has neither branches nor a variable trip count.
+  template<typename TableType, const std::size_t BlockSize, typename WorkType>
+  void iq_vector_block(WorkType* u, WorkType* v, WorkType* z, const int iterations)
+  {
+    // The shifted values x and |y| are non-negative, and they are shifted
+    // as unsigned values. Some targets lack a vectorized arithmetic right-shift.
+    typedef typename std::make_unsigned<WorkType>::type unsigned_work_type;
+
+    for(int i = 0; i < iterations; ++i)
+    {
+      const WorkType angle = TableType::circular_angle(i);
+
+      for(std::size_t k = 0U; k < BlockSize; ++k)
+      {
+        // The mask is 0 for y >= 0 and -1 for y < 0. Here, (a ^ mask) - mask is a or -a.
+        const WorkType mask = WorkType(-WorkType(v[k] < 0));
+
+        const WorkType xs = WorkType(unsigned_work_type(u[k]) >> i);
+        const WorkType ys = WorkType(unsigned_work_type(WorkType(v[k] ^ mask) - mask) >> i);
+
+        u[k] = WorkType(u[k] + ys);
+        v[k] = WorkType(v[k] - WorkType(WorkType(xs    ^ mask) - mask));
+        z[k] = WorkType(z[k] + WorkType(WorkType(angle ^ mask) - mask));
+      }
+    }
+  }
+
+  } // namespace detail
+
+  /*! Compute the sine of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void sin(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::sin(x); });
+  }
+
+  /*! Compute the cosine of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void cos(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::cos(x); });
+  }
+
+  /*! Compute the sine and the cosine of each of the count elements of the array in
+      and store the results in the arrays out_sin and out_cos.
+      The argument reduction is shared between sine and cosine.
+  */
+  template<typename NegatableType>
+  void sincos(const NegatableType* in, NegatableType* out_sin, NegatableType* out_cos, const std::size_t count)
+  {
+    static_assert(is_fixed_point<NegatableType>::value,
+                  "Error: The batch functions can only be instantiated with a fixed-point negatable type.");
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      // Copy the argument, since the input array may be one of the output arrays.
+      const NegatableType x = in[i];
+
+      boost::fixed_point::sincos(x, out_sin + i, out_cos + i);
+    }
+  }
+
+  /*! Compute the square root of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void sqrt(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::sqrt(x); });
+  }
+
+  /*! Compute the reciprocal square root of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void rsqrt(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::rsqrt(x); });
+  }
+
+  /*! Compute the exponential function of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void exp(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::exp(x); });
+  }
+
+  /*! Compute 2 raised to the power of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void exp2(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::exp2(x); });
+  }
+
+  /*! Compute the natural logarithm of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void log(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::log(x); });
+  }
+
+  /*! Compute the logarithm to base 2 of each of the count elements of the array in and store the results in the array out. */
+  template<typename NegatableType>
+  void log2(const NegatableType* in, NegatableType* out, const std::size_t count)
+  {
+    detail::transform(in, out, count, [](const NegatableType& x) -> NegatableType { return boost::fixed_point::log2(x); });
+  }
+
+  /*! Compute the arc-tangent of y / x in the range [-pi, pi] of each of the count pairs
+      of elements of the arrays in_y and in_x and store the results in the array out.
+      This is intended for the phase of in-phase (x) and quadrature (y) samples.
+      The samples are reduced to the first octant and normalized, and the angle
+      is obtained with CORDIC vectoring without division. The result is within
+      a few units of the resolution. It is not bit-identical to the scalar atan2.
+      The negatable type may have at most 32 bits.
+  */
+  template<typename NegatableType>
+  void atan2(const NegatableType* in_y, const NegatableType* in_x, NegatableType* out, const std::size_t count)
+  {
+    typedef detail::iq_vector_helper<NegatableType, true> local_helper_type;
+    typedef typename local_helper_type::work_type         local_work_type;
+    typedef typename local_helper_type::table_type        local_table_type;
+    typedef typename NegatableType::value_type            local_value_type;
+    typedef typename NegatableType::nothing               local_nothing;
+
+    BOOST_CONSTEXPR_OR_CONST int right_shift = local_helper_type::work_bits - NegatableType::radix_split;
+
+    const local_work_type pi_half = local_table_type::pi_half();
+    const local_work_type half    = local_work_type(local_work_type(1) << (right_shift - 1));
+
+    for(std::size_t j = 0U; j < count; j += local_helper_type::block_size)
+    {
+      const std::size_t n = (((count - j) < local_helper_type::block_size) ? (count - j) : local_helper_type::block_size);
+
+      local_work_type u[local_helper_type::block_size];
+      local_work_type v[local_helper_type::block_size];
+      local_work_type z[local_helper_type::block_size];
+      bool            is_swapped[local_helper_type::block_size];
+      int             shift[local_helper_type::block_size];
+
+      detail::iq_vector_load<local_helper_type>(in_x + j, in_y + j, n, UINT64_C(0x100000000), u, v, z, is_swapped, shift);
+
+      detail::iq_vector_block<local_table_type, local_helper_type::block_size>(u, v, z, local_helper_type::iterations);
+
+      for(std::size_t k = 0U; k < n; ++k)
+      {
+        const local_value_type x = in_x[j + k].crepresentation();
+        const local_value_type y = in_y[j + k].crepresentation();
+
+        // Undo the octant reduction.
+        local_work_type a = (is_swapped[k] ? local_work_type(pi_half - z[k]) : z[k]);
+
+        if(x < 0)          { a = local_work_type((pi_half * 2) - a); }
+        if(y < 0)          { a = local_work_type(-a); }
+        if(u[k] == 0)      { a = local_work_type(0); }
+
+        // Round to nearest, symmetrically about zero.
+        const bool            a_is_neg = (a < 0);
+        const local_work_type r        = local_work_type((local_work_type(a_is_neg ? -a : a) + half) >> right_shift);
+
+        out[j + k] = NegatableType(local_nothing(), local_value_type(a_is_neg ? local_work_type(-r) : r));
+      }
+    }
+  }
+
+  /*! Compute the magnitude sqrt(x^2 + y^2) of each of the count pairs of elements
+      of the arrays in_x and in_y and store the results in the array out.
+      This is intended for the envelope of in-phase (x) and quadrature (y) samples.
+      The samples are reduced to the first octant and normalized, and the magnitude
+      is obtained with CORDIC vectoring. The CORDIC gain is removed before the
+      iterations, so that neither a square root nor a division is needed.
+      The result is within a few units of the resolution. It is not bit-identical
+      to the scalar hypot. The negatable type may have at most 32 bits.
+  */
+  template<typename NegatableType>
+  void magnitude(const NegatableType* in_x, const NegatableType* in_y, NegatableType* out, const std::size_t count)
+  {
+    typedef detail::iq_vector_helper<NegatableType, false> local_helper_type;
+    typedef typename local_helper_type::work_type          local_work_type;
+    typedef typename local_helper_type::table_type         local_table_type;
+    typedef typename NegatableType::value_type             local_value_type;
+    typedef typename NegatableType::nothing                local_nothing;
+
+    // The inverse of the circular CORDIC gain scaled by 2^32.
+    const std::uint64_t gain_inverse = std::uint64_t(boost::fixed_point::detail::cordic_table<std::int64_t, 32>::circular_gain_inverse());
+
+    for(std::size_t j = 0U; j < count; j += local_helper_type::block_size)
+    {
+      const std::size_t n = (((count - j) < local_helper_type::block_size) ? (count - j) : local_helper_type::block_size);
+
+      local_work_type u[local_helper_type::block_size];
+      local_work_type v[local_helper_type::block_size];
+      local_work_type z[local_helper_type::block_size];
+      bool            is_swapped[local_helper_type::block_size];
+      int             shift[local_helper_type::block_size];
+
+      detail::iq_vector_load<local_helper_type>(in_x + j, in_y + j, n, gain_inverse, u, v, z, is_swapped, shift);
+
+      detail::iq_vector_block<local_table_type, local_helper_type::block_size>(u, v, z, local_helper_type::iterations);
+
+      for(std::size_t k = 0U; k < n; ++k)
+      {
+        // Undo the normalization with rounding to nearest. Here,
+        // the right-shift is at least 5, since the narrow working
+        // type is only used for types having 24 bits or less.
+        const int right_shift = (local_helper_type::work_bits - 32) + shift[k];
+
+        const local_work_type r = local_work_type((u[k] + local_work_type(local_work_type(1) << (right_shift - 1))) >> right_shift);
+
+        out[j + k] = NegatableType(local_nothing(), local_value_type(r));
+      }
+    }
+  }
+
+  } } } // namespace boost::fixed_point::batch
+
+#endif // FIXED_POINT_NEGATABLE_BATCH_2016_11_07_HPP_
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2013 - 2016.
+//  Copyright Nikhar Agrawal 2015.
+//  Copyright Paul Bristow 2015.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief Compile-time bit-growth analysis for expressions of fixed_point negatable operands.
+  \details The bit-growth traits deduce the narrowest @c negatable type that holds
+    the exact result of an addition, subtraction, multiplication or accumulation
+    without overflow. The exact_* functions compute the result directly
+    on the integral representation in the deduced type, without rounding.
+    For example, the type of @c exact_add(exact_multiply(a, b), exact_multiply(c, d))
+    is the narrowest overflow-free type for the expression a*b + c*d.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_BIT_GROWTH_2016_11_05_HPP_
+  #define FIXED_POINT_NEGATABLE_BIT_GROWTH_2016_11_05_HPP_
+
+  namespace boost { namespace fixed_point {
+
+  namespace detail {
+
+  // Compute ceil(log2(N)) for N >= 1 at compile time.
+  template<const std::uintmax_t N>
+  struct bit_growth_ceil_log2
+  {
+    BOOST_STATIC_CONSTEXPR int value = 1 + bit_growth_ceil_log2<(N + 1U) / 2U>::value;
+  };
+
+  template<>
+  struct bit_growth_ceil_log2<1U>
+  {
+    BOOST_STATIC_CONSTEXPR int value = 0;
+  };
+
+  } // namespace detail
+
+  /*! Deduce the narrowest negatable type holding the exact sum of two negatable operands.\n
+      The range grows by one bit beyond the wider operand range,
+      and the resolution is the finer of the two operand resolutions.
+  */
+  template<typename NegatableType1, typename NegatableType2>
+  struct bit_growth_add;
+
+  template<const int IntegralRange1, const int FractionalResolution1,
+           const int IntegralRange2, const int FractionalResolution2,
+           typename RoundMode,
+           typename OverflowMode>
+  struct bit_growth_add<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                        negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>
+  {
+    typedef negatable<((IntegralRange1        >= IntegralRange2)        ? IntegralRange1        : IntegralRange2) + 1,
+                      ((FractionalResolution1 <= FractionalResolution2) ? FractionalResolution1 : FractionalResolution2),
+                      RoundMode,
+                      OverflowMode> type;
+  };
+
+  /*! Deduce the narrowest negatable type holding the exact difference of two negatable operands.
+      This is the same as the type deduced for addition.
+  */
+  template<typename NegatableType1, typename NegatableType2>
+  struct bit_growth_subtract : public bit_growth_add<NegatableType1, NegatableType2> { };
+
+  /*! Deduce the narrowest negatable type holding the exact product of two negatable operands.\n
+      The magnitude of the product is less than 2^(IntegralRange1 + IntegralRange2),
+      and the resolution is 2^(FractionalResolution1 + FractionalResolution2).
+  */
+  template<typename NegatableType1, typename NegatableType2>
+  struct bit_growth_multiply;
+
+  template<const int IntegralRange1, const int FractionalResolution1,
+           const int IntegralRange2, const int FractionalResolution2,
+           typename RoundMode,
+           typename OverflowMode>
+  struct bit_growth_multiply<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                             negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>
+  {
+    typedef negatable<IntegralRange1 + IntegralRange2,
+                      FractionalResolution1 + FractionalResolution2,
+                      RoundMode,
+                      OverflowMode> type;
+  };
+
+  /*! Deduce the narrowest negatable type holding the exact sum of TermCount
+      terms of the same negatable type, as in an accumulation or dot product.\n
+      The range grows by ceil(log2(TermCount)) bits and the resolution is unchanged.
+  */
+  template<typename NegatableType, const std::uintmax_t TermCount>
+  struct bit_growth_accumulate;
+
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode, const std::uintmax_t TermCount>
+  struct bit_growth_accumulate<negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>, TermCount>
+  {
+    static_assert(TermCount > 0U, "Error: The term count of an accumulation must be at least one.");
+
+    typedef negatable<IntegralRange + detail::bit_growth_ceil_log2<TermCount>::value,
+                      FractionalResolution,
+                      RoundMode,
+                      OverflowMode> type;
+  };
+
+  /*! Compute the exact sum of two negatable operands in the type deduced by bit_growth_add.
+      No rounding and no overflow take place.
+  */
+  template<const int IntegralRange1, const int FractionalResolution1,
+           const int IntegralRange2, const int FractionalResolution2,
+           typename RoundMode,
+           typename OverflowMode>
+  typename bit_growth_add<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                          negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type
+  exact_add(const negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>& a,
+            const negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>& b)
+  {
+    typedef typename bit_growth_add<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                                    negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type local_result_type;
+
+    // Both conversions to the result type are widening and exact.
+    return local_result_type(a) += local_result_type(b);
+  }
+
+  /*! Compute the exact difference of two negatable operands in the type deduced by bit_growth_subtract.
+      No rounding and no overflow take place.
+  */
+  template<const int IntegralRange1, const int FractionalResolution1,
+           const int IntegralRange2, const int FractionalResolution2,
+           typename RoundMode,
+           typename OverflowMode>
+  typename bit_growth_subtract<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                               negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type
+  exact_subtract(const negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>& a,
+                 const negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>& b)
+  {
+    typedef typename bit_growth_subtract<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                                         negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type local_result_type;
+
+    return local_result_type(a) -= local_result_type(b);
+  }
+
+  /*! Compute the exact product of two negatable operands in the type deduced by bit_growth_multiply.\n
+      The product is formed with a single multiplication of the integral representations
+      in the (narrow) result type. No rounding and no overflow take place.
+  */
+  template<const int IntegralRange1, const int FractionalResolution1,
+           const int IntegralRange2, const int FractionalResolution2,
+           typename RoundMode,
+           typename OverflowMode>
+  typename bit_growth_multiply<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                               negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type
+  exact_multiply(const negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>& a,
+                 const negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>& b)
+  {
+    typedef typename bit_growth_multiply<negatable<IntegralRange1, FractionalResolution1, RoundMode, OverflowMode>,
+                                         negatable<IntegralRange2, FractionalResolution2, RoundMode, OverflowMode>>::type local_result_type;
+
+    typedef typename local_result_type::value_type local_value_type;
+    typedef typename local_result_type::nothing    local_nothing;
+
+    // The resolution of the product of the representations is exactly
+    // the resolution of the result type. So there is no shift and no rounding.
+    return local_result_type(local_nothing(),
+                             local_value_type(local_value_type(a.crepresentation()) * local_value_type(b.crepresentation())));
+  }
+
+  } } // namespace boost::fixed_point
+
+#endif // FIXED_POINT_NEGATABLE_BIT_GROWTH_2016_11_05_HPP_
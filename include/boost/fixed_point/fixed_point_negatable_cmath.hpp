@@ -18,6 +18,10 @@
 #ifndef FIXED_POINT_NEGATABLE_CMATH_2015_08_21_HPP_
   #define FIXED_POINT_NEGATABLE_CMATH_2015_08_21_HPP_
 
+  #include <cstddef>
+  #include <cstdint>
+  #include <vector>
+
   namespace boost { namespace fixed_point {
 
   /*! Absolute function. 
@@ -412,6 +416,112 @@
     return result;
   }
 
+  namespace detail
+  {
+    /*! Helper for the minimax polynomial approximations of fixed_point_detail_minimax.hpp
+        with fractional resolution > 24 bits. The coefficients of the resolution tier
+        of NegatableType are scaled to its representation on the fly. The type
+        is_available is std::false_type for fractional resolutions beyond the widest
+        tier, for which the elementary functions fall back to their series.
+    */
+    template<typename NegatableType>
+    struct minimax_helper
+    {
+      BOOST_STATIC_CONSTEXPR int tier = minimax_tier<NegatableType::radix_split>::value;
+
+      typedef std::integral_constant<bool, (tier != 0)> is_available;
+
+      /*! Compute the polynomial P(t) of the table with the method of Horner.\n
+      */
+      template<typename TableType>
+      static NegatableType polynomial(const NegatableType& t)
+      {
+        const minimax_coefficient* c = TableType::coefficients();
+
+        NegatableType sum = coefficient(c[TableType::coefficient_count - 1U]);
+
+        for(std::size_t k = TableType::coefficient_count - 1U; k > 0U; --k)
+        {
+          sum = (sum * t) + coefficient(c[k - 1U]);
+        }
+
+        return sum;
+      }
+
+    private:
+      typedef typename NegatableType::value_type value_type;
+      typedef typename NegatableType::nothing    nothing;
+
+      // Scale the coefficient to the representation with rounding to nearest.
+      static NegatableType coefficient(const minimax_coefficient& c)
+      {
+        const int right_shift = -(c.exponent + NegatableType::radix_split);
+
+        value_type u;
+
+        if(right_shift <= 0)
+        {
+          u = value_type(value_type(c.mantissa) << -right_shift);
+        }
+        else if(right_shift < 64)
+        {
+          u = value_type((c.mantissa >> right_shift) + ((c.mantissa >> (right_shift - 1)) & 1U));
+        }
+        else
+        {
+          u = value_type((right_shift == 64) ? (c.mantissa >> 63) : UINT64_C(0));
+        }
+
+        return (c.is_neg ? -NegatableType(nothing(), u) : NegatableType(nothing(), u));
+      }
+    };
+
+    // Estimate the square root of the reduced argument 1/2 <= a < 1
+    // with a minimax polynomial. An odd power of two is absorbed into a.
+    // Return the binary digits of precision of the estimate.
+    template<typename NegatableType>
+    std::uint_fast16_t sqrt_wide_initial_guess(NegatableType& a, int& n2, std::true_type)
+    {
+      typedef typename NegatableType::unsigned_small_type local_unsigned_small_type;
+      typedef typename NegatableType::value_type          local_value_type;
+
+      typedef minimax_sqrt<minimax_helper<NegatableType>::tier> table_type;
+
+      if((n2 % 2) != 0)
+      {
+        a.representation() = local_value_type(local_unsigned_small_type(a.representation()) >> 1);
+
+        ++n2;
+      }
+
+      a = minimax_helper<NegatableType>::template polynomial<table_type>(a);
+
+      return std::uint_fast16_t(table_type::precision_bits);
+    }
+
+    template<typename NegatableType>
+    std::uint_fast16_t sqrt_wide_initial_guess(NegatableType& a, int&, std::false_type)
+    {
+      typedef typename NegatableType::unsigned_small_type local_unsigned_small_type;
+      typedef typename NegatableType::value_type          local_value_type;
+
+      // Use the reduced argument (a) in order to create an
+      // estimate for the initial guess of the square root of x.
+      // Here we use:
+      //  sqrt(a) = approx. (a/2) + [8^(1/4) - 1]^2
+      //          = approx. (a/2) + 0.4648
+      //          = approx. [(a + 1) /2] via naive simplification.
+
+      // See, for example, J. F. Hart et al., Computer Approximations
+      // (John Wiley and Sons, Inc., 1968), Eq. 2.4.3 on page 27.
+
+      // Compute the initial guess [(a + 1) /2].
+      a.representation() = local_value_type(local_unsigned_small_type(local_unsigned_small_type(a.representation()) + local_unsigned_small_type(local_unsigned_small_type(1U) << NegatableType::radix_split)) >> 1);
+
+      return UINT16_C(1);
+    }
+  } // namespace detail
+
   /*! Computes sqrt for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
   negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
@@ -440,20 +550,10 @@
     int n2;
     local_negatable_type a = frexp(x, &n2);
 
-    // Get the initial guess of the square root.
-
-    // Use the reduced argument (a) in order to create an
-    // estimate for the initial guess of the square root of x.
-    // Here we use:
-    //  sqrt(a) = approx. (a/2) + [8^(1/4) - 1]^2
-    //          = approx. (a/2) + 0.4648
-    //          = approx. [(a + 1) /2] via naive simplification.
-
-    // See, for example, J. F. Hart et al., Computer Approximations
-    // (John Wiley and Sons, Inc., 1968), Eq. 2.4.3 on page 27.
-
-    // Compute the initial guess [(a + 1) /2].
-    a.representation() = local_value_type(local_unsigned_small_type(local_unsigned_small_type(a.representation()) + local_unsigned_small_type(local_unsigned_small_type(1U) << local_negatable_type::radix_split)) >> 1);
+    // Get the initial guess of the square root. Use a minimax polynomial
+    // if one is available for the resolution of the type.
+    const std::uint_fast16_t initial_precision =
+      detail::sqrt_wide_initial_guess(a, n2, typename detail::minimax_helper<local_negatable_type>::is_available());
 
     // Remove the scaling from the reduced guess of the result
     // and use this as the proper initial guess of sqrt(x).
@@ -482,17 +582,17 @@
     }
 
     // Estimate the zero'th term of the iteration with [1 / (2 * result)].
-    local_negatable_type vi = local_negatable_type(1U) / (a * 2U);
+    local_negatable_type vi = local_negatable_type(1U) / (a * std::integral_constant<unsigned, 2U>());
 
     // Compute the square root of x using coupled Newton iteration.
     // More precisely, this is the Schoenhage variation thereof.
-    // We begin with an estimate of 1 binary digit of precision and
-    // double the number of binary digits of precision with each iteration.
+    // We begin with the precision of the initial guess and double
+    // the number of binary digits of precision with each iteration.
 
-    for(std::uint_fast16_t i = UINT16_C(1); i <= std::uint_fast16_t(local_negatable_type::all_bits / 2); i *= UINT16_C(2))
+    for(std::uint_fast16_t i = initial_precision; i < std::uint_fast16_t(local_negatable_type::all_bits); i *= UINT16_C(2))
     {
       // Perform the next iteration of vi.
-      vi += vi * (1U -((a * vi) * 2U));
+      vi += vi * (1U -((a * vi) * std::integral_constant<unsigned, 2U>()));
 
       // Perform the next iteration of the result.
       a += (vi * (x - (a * a)));
@@ -501,1279 +601,2837 @@
     return a;
   }
 
-  /*! Computes exponent for fractional resolution < 11 bits. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  namespace detail
   {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
+    /*! The helper reciprocal_helper implements the Newton-Raphson iterations
+        of the reciprocal and the reciprocal square root in the integral domain
+        of NegatableType. The argument is normalized to a mantissa m = d * 2^digits
+        of unsigned_small_type, and the iterate y is held in the format
+        Q1.(digits - 1). The iterations start from a table-based seed
+        having 9 binary digits and roughly double the precision with each step.
+    */
+    template<typename NegatableType>
+    struct reciprocal_helper
+    {
+      typedef typename NegatableType::unsigned_small_type unsigned_small_type;
+
+      BOOST_STATIC_CONSTEXPR int digits = std::numeric_limits<unsigned_small_type>::digits;
+
+      // Compute the most significant bit of the non-zero value u.
+      static int msb(const unsigned_small_type& u)
+      {
+        unsigned_small_type tmp (u);
+        unsigned_small_type mask((std::numeric_limits<unsigned_small_type>::max)());
 
-    // Handle zero argument.
-    if(x.crepresentation() == 0)
-    {
-      return local_negatable_type(1U);
-    }
+        return int(detail::msb_helper(tmp, mask, std::uint_fast16_t(digits)));
+      }
 
-    // Handle unity argument.
-    if(x == local_negatable_type(1U))
-    {
-      return negatable_constants<local_negatable_type>::e();
-    }
+      // Compute y = 1 / d for the mantissa m = d * 2^digits, with 1/2 <= d < 1.
+      static unsigned_small_type recip(const unsigned_small_type& m)
+      {
+        unsigned_small_type y = seed(reciprocal_seed::recip(index(m)));
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
-    {
-      return 1 / exp(-x);
-    }
+        const unsigned_small_type one(unsigned_small_type(1U) << (digits - 1));
 
-    int nf = 0;
+        for(int n = reciprocal_seed::index_bits; n < digits; n = (2 * n) - 1)
+        {
+          // Compute the residual e = 1 - (d * y) and iterate y += (y * e).
+          const unsigned_small_type dy = multiply_hi(m, y);
 
-    if(x > negatable_constants<local_negatable_type>::ln_two())
-    {
-      nf = int(x / negatable_constants<local_negatable_type>::ln_two());
+          y = ((dy < one) ? increment(y, multiply_hi(y, unsigned_small_type(one - dy)))
+                          : decrement(y, multiply_hi(y, unsigned_small_type(dy - one))));
+        }
 
-      x -= (negatable_constants<local_negatable_type>::ln_two() * nf);
-    }
+        return y;
+      }
 
-    // Use a polynomial approximation.
-    // exp(x) - 1 = approx. + 0.99792060811054451 x
-    //                      + 0.49948832659208106 x^2
-    //                      + 0.17621882066892929 x^3
-    //                      + 0.04348249331418186 x^4,
-    // in the range -1 <= x <= +1. These coefficients
-    // have been specifically derived for this work.
+      // Compute y = 1 / sqrt(d) for the mantissa m = d * 2^digits, with 1/4 <= d < 1.
+      static unsigned_small_type rsqrt(const unsigned_small_type& m)
+      {
+        unsigned_small_type y = seed(reciprocal_seed::rsqrt(index(m)));
 
-    // Perform the polynomial approximation using a coefficient
-    // expansion via the method of Horner.
-    local_negatable_type result =
-      (((      local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0059) >> (11 + FractionalResolution)))   // 0.04348249331418186
-         * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0168) >> (11 + FractionalResolution))))  // 0.17621882066892929
-         * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x03FE) >> (11 + FractionalResolution))))  // 0.49948832659208106
-         * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FB) >> (11 + FractionalResolution))))  // 0.99792060811054451
-         * x;
+        // The product d * y^2 is in the format Q2.(digits - 2).
+        const unsigned_small_type one(unsigned_small_type(1U) << (digits - 2));
 
-    ++result;
+        for(int n = reciprocal_seed::index_bits; n < digits; n = (2 * n) - 1)
+        {
+          // Compute the residual e = 1 - (d * y^2) and iterate y += (y * e) / 2.
+          const unsigned_small_type dy2 = multiply_hi(m, multiply_hi(y, y));
 
-    if(nf > 0)
-    {
-      result.representation() <<= nf;
-    }
+          y = ((dy2 < one) ? increment(y, multiply_hi(y, unsigned_small_type(one - dy2)))
+                           : decrement(y, multiply_hi(y, unsigned_small_type(dy2 - one))));
+        }
 
-    return result;
-  }
+        return y;
+      }
 
-  /*! Computes exponent for fractional resolution  24 bits. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
+      // Scale the iterate y to the representation y * 2^(-right_shift).
+      // The value y = 2, which is not representable in Q1.(digits - 1),
+      // is flagged with is_two. The result saturates at the maximum.
+      static unsigned_small_type scale(const unsigned_small_type& y,
+                                       const int right_shift,
+                                       const bool is_two,
+                                       const bool round_to_nearest)
+      {
+        const unsigned_small_type max_value((std::numeric_limits<NegatableType>::max)().crepresentation());
 
-    // Handle zero argument.
-    if(x.crepresentation() == 0)
-    {
-      return local_negatable_type(1U);
-    }
+        if(right_shift <= 0)
+        {
+          return max_value;
+        }
 
-    // Handle unity argument.
-    if(x == local_negatable_type(1U))
-    {
-      return negatable_constants<local_negatable_type>::e();
-    }
+        unsigned_small_type r(0U);
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
-    {
-      return 1 / exp(-x);
-    }
+        if(is_two)
+        {
+          if(right_shift <= digits)
+          {
+            r = unsigned_small_type(unsigned_small_type(1U) << (digits - right_shift));
+          }
+        }
+        else if(right_shift < digits)
+        {
+          r = unsigned_small_type(y >> right_shift);
 
-    int nf = 0;
+          if(round_to_nearest && (std::uint_fast8_t(unsigned_small_type(y >> (right_shift - 1)) & 1U) != 0U))
+          {
+            ++r;
+          }
+        }
+        else if(round_to_nearest && (right_shift == digits))
+        {
+          r = unsigned_small_type(y >> (digits - 1));
+        }
 
-    if(x > negatable_constants<local_negatable_type>::ln_two())
-    {
-      nf = int(x / negatable_constants<local_negatable_type>::ln_two());
+        return ((r < max_value) ? r : max_value);
+      }
 
-      x -= (negatable_constants<local_negatable_type>::ln_two() * nf);
-    }
+      // Correct the approximate reciprocal r of the representation u
+      // to the nearest value, fulfilling (2r - 1) * u <= 2^p < (2r + 1) * u
+      // with p = (2 * radix_split) + 1.
+      static unsigned_small_type recip_nearest(unsigned_small_type r, const unsigned_small_type& u)
+      {
+        const unsigned_small_type max_value((std::numeric_limits<NegatableType>::max)().crepresentation());
 
-    // Use a polynomial approximation.
-    // exp(x) - 1 = approx. + 0.9999999247233815 x
-    //                      + 0.5000038123608412 x^2
-    //                      + 0.1666677606703556 x^3
-    //                      + 0.0416417643582255 x^4
-    //                      + 0.0083291093882400 x^5
-    //                      + 0.0014345483118123 x^6
-    //                      + 0.0002043732656744 x^7,
-    // in the range -1 <= x <= +1. These coefficients
-    // have been specifically derived for this work.
+        BOOST_CONSTEXPR_OR_CONST int p = (2 * NegatableType::radix_split) + 1;
 
-    // Perform the polynomial approximation using a coefficient
-    // expansion via the method of Horner.
-    local_negatable_type result =
-      ((((((      local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000D64) >> (24 + FractionalResolution)))   // 0.0002043732656744
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00005E03) >> (24 + FractionalResolution))))  // 0.0014345483118123
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000221DB) >> (24 + FractionalResolution))))  // 0.0083291093882400
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000AA908) >> (24 + FractionalResolution))))  // 0.0416417643582255
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAABD) >> (24 + FractionalResolution))))  // 0.1666677606703556
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0080003F) >> (24 + FractionalResolution))))  // 0.5000038123608412
-            * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFFE) >> (24 + FractionalResolution))))  // 0.9999999247233815
-            * x;
+        while((r < max_value) && (!product_exceeds(unsigned_small_type(unsigned_small_type(r << 1) | 1U), u, p)))
+        {
+          ++r;
+        }
 
-    ++result;
+        while((r > 0U) && product_exceeds(unsigned_small_type(unsigned_small_type(r << 1) - 1U), u, p))
+        {
+          --r;
+        }
 
-    if(nf > 0)
-    {
-      result.representation() <<= nf;
-    }
+        return r;
+      }
 
-    return result;
-  }
+    private:
+      // Extract the leading bits of the mantissa as table index.
+      static std::uint_fast16_t index(const unsigned_small_type& m)
+      {
+        return index(m, std::integral_constant<bool, (digits >= 16)>());
+      }
 
-  /*! Computes exponent for fractional resolution > 24 bits. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+      static std::uint_fast16_t index(const unsigned_small_type& m, std::true_type)
+      {
+        return static_cast<std::uint_fast16_t>(m >> (digits - reciprocal_seed::index_bits));
+      }
 
-    // Handle zero argument.
-    if(x.crepresentation() == 0)
-    {
-      return local_negatable_type(1U);
-    }
+      static std::uint_fast16_t index(const unsigned_small_type& m, std::false_type)
+      {
+        return static_cast<std::uint_fast16_t>(std::uint_fast16_t(m) << (reciprocal_seed::index_bits - digits));
+      }
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
-    {
-      return 1 / exp(-x);
-    }
+      // Scale the seed from Q1.15 to Q1.(digits - 1).
+      static unsigned_small_type seed(const std::uint16_t s)
+      {
+        return seed(s, std::integral_constant<bool, (digits >= 16)>());
+      }
 
-    int nf = 0;
+      static unsigned_small_type seed(const std::uint16_t s, std::true_type)
+      {
+        return unsigned_small_type(unsigned_small_type(s) << (digits - 16));
+      }
 
-    if(x > negatable_constants<local_negatable_type>::ln_two())
-    {
-      nf = int(x / negatable_constants<local_negatable_type>::ln_two());
+      static unsigned_small_type seed(const std::uint16_t s, std::false_type)
+      {
+        return unsigned_small_type(s >> (16 - digits));
+      }
 
-      x -= (negatable_constants<local_negatable_type>::ln_two() * nf);
-    }
+      // Add or subtract twice the correction h of the iteration.
+      // The addition saturates in order to avoid wrapping near y = 2.
+      static unsigned_small_type increment(const unsigned_small_type& y, const unsigned_small_type& h)
+      {
+        const unsigned_small_type dy(h << 1);
 
-    local_negatable_type result = detail::hypergeometric_0f0(x);
+        return ((y <= unsigned_small_type((std::numeric_limits<unsigned_small_type>::max)() - dy))
+                 ? unsigned_small_type(y + dy)
+                 : (std::numeric_limits<unsigned_small_type>::max)());
+      }
 
-    if(nf > 0)
-    {
-      result.representation() <<= nf;
-    }
+      static unsigned_small_type decrement(const unsigned_small_type& y, const unsigned_small_type& h)
+      {
+        return unsigned_small_type(y - unsigned_small_type(h << 1));
+      }
 
-    return result;
+    #if !defined(BOOST_FIXED_POINT_DISABLE_WIDE_INTEGER_MATH)
+
+      typedef typename NegatableType::unsigned_large_type unsigned_large_type;
+
+      // Compute the upper half of the product u * v.
+      static unsigned_small_type multiply_hi(const unsigned_small_type& u, const unsigned_small_type& v)
+      {
+        return unsigned_small_type((unsigned_large_type(u) * unsigned_large_type(v)) >> digits);
+      }
+
+      // Determine if the product u * v exceeds 2^p.
+      static bool product_exceeds(const unsigned_small_type& u, const unsigned_small_type& v, const int p)
+      {
+        return ((unsigned_large_type(u) * unsigned_large_type(v)) > (unsigned_large_type(1U) << p));
+      }
+
+    #else
+
+      // Compute the upper half of the product u * v.
+      static unsigned_small_type multiply_hi(const unsigned_small_type& u, const unsigned_small_type& v)
+      {
+        unsigned_small_type result_lo;
+        unsigned_small_type result_hi;
+
+        detail::two_component_multiply<unsigned_small_type>(u, v, result_lo, result_hi);
+
+        return result_hi;
+      }
+
+      // Determine if the product u * v exceeds 2^p.
+      static bool product_exceeds(const unsigned_small_type& u, const unsigned_small_type& v, const int p)
+      {
+        unsigned_small_type result_lo;
+        unsigned_small_type result_hi;
+
+        detail::two_component_multiply<unsigned_small_type>(u, v, result_lo, result_hi);
+
+        const unsigned_small_type p_lo((p <  digits) ? unsigned_small_type(unsigned_small_type(1U) << p)            : unsigned_small_type(0U));
+        const unsigned_small_type p_hi((p >= digits) ? unsigned_small_type(unsigned_small_type(1U) << (p - digits)) : unsigned_small_type(0U));
+
+        return ((result_hi > p_hi) || ((result_hi == p_hi) && (result_lo > p_lo)));
+      }
+
+    #endif // BOOST_FIXED_POINT_DISABLE_WIDE_INTEGER_MATH
+    };
   }
 
-  /*! Computes natural log for fractional resolution < 11 bits. */
+  /*! Computes the reciprocal 1 / x.\n
+      The reciprocal is computed with Newton-Raphson iteration in the integral
+      domain, starting from a table-based seed of the normalized argument.
+      With round::fastest, the result is truncated and the error is at most
+      a few ULP. With the other rounding modes, the result is corrected
+      to the nearest representable value. The result is zero for x = 0,
+      and it saturates at the limits of the type.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> recip(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::unsigned_small_type                      local_unsigned_small_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
     typedef typename local_negatable_type::nothing                                  local_nothing;
+    typedef detail::reciprocal_helper<local_negatable_type>                         local_helper_type;
 
-    local_negatable_type result;
+    BOOST_CONSTEXPR_OR_CONST bool round_to_nearest = (std::is_same<RoundMode, round::fastest>::value == false);
 
-    if(x < 1)
+    if(x.crepresentation() == 0)
     {
-      result = ((x.crepresentation() > 0) ? -log(1 / x) : -(std::numeric_limits<local_negatable_type>::max)());
+      return local_negatable_type(0U);
     }
-    else if(x > 1)
-    {
-      int n = 0;
-
-      if(x > 2)
-      {
-        // Use a binary-halving mechanism to obtain the most significant bit.
-        // This will subsequently be used for argument reduction below.
-
-        BOOST_CONSTEXPR_OR_CONST std::uint_fast16_t unsigned_small_digits =
-          static_cast<std::uint_fast16_t>(std::numeric_limits<local_unsigned_small_type>::digits);
 
-        local_unsigned_small_type unsigned_small_mask((std::numeric_limits<local_unsigned_small_type>::max)());
-
-        local_unsigned_small_type tmp = static_cast<local_unsigned_small_type>(x.crepresentation());
-
-        const std::uint_fast16_t msb = detail::msb_helper(tmp, unsigned_small_mask, unsigned_small_digits);
+    const bool is_neg = (x.crepresentation() < 0);
 
-        // Evaluate the necessary amount of right-shift.
-        n = int(msb) - local_negatable_type::radix_split;
+    const local_unsigned_small_type u((!is_neg) ? local_unsigned_small_type(x.crepresentation()) : local_unsigned_small_type(-x.crepresentation()));
 
-        x.representation() = local_value_type(local_unsigned_small_type(x.crepresentation()) >> n);
-      }
+    // Normalize u to the mantissa m = d * 2^digits, with 1/2 <= d < 1.
+    const int msb = local_helper_type::msb(u);
 
-      // Use a polynomial approximation of the base-2 logarithm.
-      // log2(x + 1) = approx. + 1.4385022043619629 x
-      //                       - 0.6777697968275845 x^2
-      //                       + 0.3230078286559936 x^3
-      //                       - 0.0839120707923452 x^4,
-      // in the range 0 <= x <= 1. These coefficients
-      // have been specifically derived for this work.
+    const local_unsigned_small_type m(u << ((local_helper_type::digits - 1) - msb));
 
-      // Note that the result of the polynomial aproximation
-      // is a base-2 logarithm.
+    const bool is_two = (m == local_unsigned_small_type(local_unsigned_small_type(1U) << (local_helper_type::digits - 1)));
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      const local_negatable_type z = (x - 1);
+    const local_unsigned_small_type y = (is_two ? local_unsigned_small_type(0U) : local_helper_type::recip(m));
 
-      const local_negatable_type polynomial_approximation =
-        (((    - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x00AB) >> (11 + FractionalResolution)))   // 0.0839120707923452
-           * z + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0295) >> (11 + FractionalResolution))))  // 0.3230078286559936
-           * z - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x056C) >> (11 + FractionalResolution))))  // 0.6777697968275845
-           * z + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0B82) >> (11 + FractionalResolution))))  // 1.4385022043619629
-           * z;
+    // The representation of the result is 2^(2 * radix_split) / u.
+    const int right_shift = (msb + local_helper_type::digits) - (2 * local_negatable_type::radix_split);
 
-      // Scale the result to a base-e logarithm.
-      const local_negatable_type log_value = polynomial_approximation * negatable_constants<local_negatable_type>::ln_two();
+    local_unsigned_small_type result = local_helper_type::scale(y, right_shift, is_two, round_to_nearest);
 
-      // Scale with the logarithms of the powers of 2 if necessary.
-      result = ((n == 0) ? log_value : (log_value + (n * negatable_constants<local_negatable_type>::ln_two())));
-    }
-    else
+    if(round_to_nearest && (!is_two))
     {
-      // The argument is exactly equal to 1.
-      result = local_negatable_type(0U);
+      result = local_helper_type::recip_nearest(result, u);
     }
 
-    return result;
+    return local_negatable_type(local_nothing(), local_value_type((!is_neg) ?  local_value_type(result)
+                                                                            : -local_value_type(result)));
   }
 
-  /*! Computes natural log for fractional resolution < 24 bits. */
+  /*! Computes the reciprocal square root 1 / sqrt(x).\n
+      The reciprocal square root is computed with Newton-Raphson iteration
+      in the integral domain, starting from a table-based seed of the
+      normalized argument. With round::fastest, the result is truncated.
+      With the other rounding modes, the result is rounded to nearest.
+      The error is at most a few ULP. The result is zero for x <= 0,
+      and it saturates at the maximum of the type.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> rsqrt(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::unsigned_small_type                      local_unsigned_small_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
     typedef typename local_negatable_type::nothing                                  local_nothing;
+    typedef detail::reciprocal_helper<local_negatable_type>                         local_helper_type;
 
-    local_negatable_type result;
+    BOOST_CONSTEXPR_OR_CONST bool round_to_nearest = (std::is_same<RoundMode, round::fastest>::value == false);
 
-    if(x < 1)
+    if(x.crepresentation() <= 0)
     {
-      result = ((x.crepresentation() > 0) ? -log(1 / x) : -(std::numeric_limits<local_negatable_type>::max)());
+      return local_negatable_type(0U);
     }
-    else if(x > 1)
-    {
-      int n = 0;
 
-      if(x > 2)
-      {
-        // Use a binary-halving mechanism to obtain the most significant bit.
-        // This will subsequently be used for argument reduction below.
+    const local_unsigned_small_type u(x.crepresentation());
 
-        BOOST_CONSTEXPR_OR_CONST std::uint_fast16_t unsigned_small_digits =
-          static_cast<std::uint_fast16_t>(std::numeric_limits<local_unsigned_small_type>::digits);
+    // Normalize u to the mantissa m = d * 2^digits, with 1/4 <= d < 1,
+    // such that x = d * 2^e has an even binary exponent e.
+    const int msb = local_helper_type::msb(u);
 
-        local_unsigned_small_type unsigned_small_mask((std::numeric_limits<local_unsigned_small_type>::max)());
+    const bool exponent_is_odd = (((msb + 1) - local_negatable_type::radix_split) % 2) != 0;
 
-        local_unsigned_small_type tmp = static_cast<local_unsigned_small_type>(x.crepresentation());
+    const int e = ((msb + 1) - local_negatable_type::radix_split) + (exponent_is_odd ? 1 : 0);
 
-        const std::uint_fast16_t msb = detail::msb_helper(tmp, unsigned_small_mask, unsigned_small_digits);
+    const local_unsigned_small_type m(u << (((local_helper_type::digits - 1) - msb) - (exponent_is_odd ? 1 : 0)));
 
-        // Evaluate the necessary amount of right-shift.
-        n = int(msb) - local_negatable_type::radix_split;
+    const bool is_two = (m == local_unsigned_small_type(local_unsigned_small_type(1U) << (local_helper_type::digits - 2)));
 
-        x.representation() = local_value_type(local_unsigned_small_type(x.crepresentation()) >> n);
-      }
+    const local_unsigned_small_type y = (is_two ? local_unsigned_small_type(0U) : local_helper_type::rsqrt(m));
 
-      // Use a polynomial approximation of the base-2 logarithm.
-      // log2(x + 1) = approx. + 1.44265859709491 x
-      //                       - 0.72044516000712 x^2
-      //                       + 0.47280304531019 x^3
-      //                       - 0.32400619521798 x^4
-      //                       + 0.19183861358090 x^5
-      //                       - 0.07798258678209 x^6
-      //                       + 0.01513421407398 x^7,
-      // in the range 0 <= x <= 1. These coefficients
-      // have been specifically derived for this work.
+    // The representation of the result is 2^radix_split / sqrt(d * 2^e).
+    const int right_shift = ((local_helper_type::digits - 1) + (e / 2)) - local_negatable_type::radix_split;
+
+    const local_unsigned_small_type result = local_helper_type::scale(y, right_shift, is_two, round_to_nearest);
+
+    return local_negatable_type(local_nothing(), local_value_type(result));
+  }
+
+  namespace detail
+  {
+    // Compute 2^f for -1/2 <= f <= +1/2 and fractional resolution <= 11 bits.
+    template<typename NegatableType>
+    NegatableType exp2_polynomial(const NegatableType& f,
+                                  typename std::enable_if<11 >= NegatableType::radix_split>::type const* = nullptr)
+    {
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
 
-      // Note that the result of the polynomial aproximation
-      // is a base-2 logarithm.
+      BOOST_CONSTEXPR_OR_CONST int right_shift = 11 - NegatableType::radix_split;
+
+      // Use a polynomial approximation.
+      // 2^f - 1 = approx. f * (+ 0.6931367276599452
+      //                        + 0.2402216764057989 f
+      //                        + 0.0558383327629780 f^2
+      //                        + 0.0096760428539448 f^3),
+      // in the range -1/2 <= f <= +1/2. These coefficients
+      // have been specifically derived for this work.
 
       // Perform the polynomial approximation using a coefficient
       // expansion via the method of Horner.
-      const local_negatable_type z = (x - 1);
-
-      const local_negatable_type polynomial_approximation =
-        ((((((      local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0003DFD5) >> (24 + FractionalResolution)))   // 0.01513421407398
-              * z - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0013F6AA) >> (24 + FractionalResolution))))  // 0.07798258678209
-              * z + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00311C55) >> (24 + FractionalResolution))))  // 0.19183861358090
-              * z - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0052F211) >> (24 + FractionalResolution))))  // 0.32400619521798
-              * z + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0079099E) >> (24 + FractionalResolution))))  // 0.47280304531019
-              * z - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00B86F18) >> (24 + FractionalResolution))))  // 0.72044516000712
-              * z + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01715212) >> (24 + FractionalResolution))))  // 1.44265859709491
-              * z;
+      NegatableType result =
+        (((      NegatableType(local_nothing(), local_value_type(UINT16_C(0x0014) >> right_shift))   // 0.0096760428539448
+           * f + NegatableType(local_nothing(), local_value_type(UINT16_C(0x0072) >> right_shift)))  // 0.0558383327629780
+           * f + NegatableType(local_nothing(), local_value_type(UINT16_C(0x01EC) >> right_shift)))  // 0.2402216764057989
+           * f + NegatableType(local_nothing(), local_value_type(UINT16_C(0x058C) >> right_shift)))  // 0.6931367276599452
+           * f;
 
-      // Scale the result to a base-e logarithm.
-      const local_negatable_type log_value = polynomial_approximation * negatable_constants<local_negatable_type>::ln_two();
+      ++result;
 
-      // Scale with the logarithms of the powers of 2 if necessary.
-      result = ((n == 0) ? log_value : (log_value + (n * negatable_constants<local_negatable_type>::ln_two())));
+      return result;
     }
-    else
+
+    // Compute 2^f for -1/2 <= f <= +1/2 and fractional resolution <= 24 bits.
+    template<typename NegatableType>
+    NegatableType exp2_polynomial(const NegatableType& f,
+                                  typename std::enable_if<(24 >= NegatableType::radix_split) && (11 < NegatableType::radix_split)>::type const* = nullptr)
     {
-      // The argument is exactly equal to 1.
-      result = local_negatable_type(0U);
-    }
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
 
-    return result;
-  }
+      BOOST_CONSTEXPR_OR_CONST int right_shift = 24 - NegatableType::radix_split;
 
-  /*! Computes natural log for fractional resolution > 24 bits. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::unsigned_small_type                      local_unsigned_small_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
+      // Use a polynomial approximation.
+      // 2^f - 1 = approx. f * (+ 0.6931471805537159
+      //                        + 0.2402265092233671 f
+      //                        + 0.0555041092876396 f^2
+      //                        + 0.0096180566708509 f^3
+      //                        + 0.0013333454539879 f^4
+      //                        + 0.0001546144715432 f^5
+      //                        + 0.0000153100830346 f^6),
+      // in the range -1/2 <= f <= +1/2. These coefficients
+      // have been specifically derived for this work.
 
-    local_negatable_type result;
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      NegatableType result =
+        ((((((      NegatableType(local_nothing(), local_value_type(UINT32_C(0x00000101) >> right_shift))   // 0.0000153100830346
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x00000A22) >> right_shift)))  // 0.0001546144715432
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x00005762) >> right_shift)))  // 0.0013333454539879
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x00027654) >> right_shift)))  // 0.0096180566708509
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x000E3584) >> right_shift)))  // 0.0555041092876396
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x003D7F7C) >> right_shift)))  // 0.2402265092233671
+              * f + NegatableType(local_nothing(), local_value_type(UINT32_C(0x00B17218) >> right_shift)))  // 0.6931471805537159
+              * f;
+
+      ++result;
 
-    if(x < 1)
-    {
-      result = ((x.crepresentation() > 0) ? -log(1 / x) : -(std::numeric_limits<local_negatable_type>::max)());
+      return result;
     }
-    else if(x > 1)
+
+    // Split x into x = n + f, with the integer n nearest to x and -1/2 <= f <= +1/2.
+    // The split is carried out on the magnitude of the representation.
+    template<typename NegatableType>
+    NegatableType exp2_split(const NegatableType& x, int& n)
     {
-      int n = 0;
+      typedef typename NegatableType::unsigned_small_type local_unsigned_small_type;
+      typedef typename NegatableType::value_type          local_value_type;
+      typedef typename NegatableType::nothing             local_nothing;
 
-      if(x > 2)
-      {
-        // Use a binary-halving mechanism to obtain the most significant bit.
-        // This will subsequently be used for argument reduction below.
+      BOOST_CONSTEXPR_OR_CONST int radix_split = NegatableType::radix_split;
 
-        BOOST_CONSTEXPR_OR_CONST std::uint_fast16_t unsigned_small_digits =
-          static_cast<std::uint_fast16_t>(std::numeric_limits<local_unsigned_small_type>::digits);
+      const bool is_neg = (x.crepresentation() < 0);
 
-        local_unsigned_small_type unsigned_small_mask((std::numeric_limits<local_unsigned_small_type>::max)());
+      const local_unsigned_small_type u(is_neg ? local_unsigned_small_type(-x.crepresentation())
+                                               : local_unsigned_small_type(+x.crepresentation()));
 
-        local_unsigned_small_type tmp = static_cast<local_unsigned_small_type>(x.crepresentation());
+      // Round the magnitude to the nearest integer.
+      const local_unsigned_small_type k((u + (local_unsigned_small_type(1U) << (radix_split - 1))) >> radix_split);
 
-        const std::uint_fast16_t msb = detail::msb_helper(tmp, unsigned_small_mask, unsigned_small_digits);
+      const local_value_type f(local_value_type(u) - local_value_type(k << radix_split));
 
-        // Evaluate the necessary amount of right-shift.
-        n = int(msb) - local_negatable_type::radix_split;
+      n = (is_neg ? -static_cast<int>(k) : static_cast<int>(k));
 
-        x.representation() = local_value_type(local_unsigned_small_type(x.representation()) >> n);
-      }
-      else
-      {
-        n = 0;
-      }
+      return NegatableType(local_nothing(), (is_neg ? local_value_type(-f) : f));
+    }
 
-      local_negatable_type log_val;
+    // Scale p = 2^f with 2^n. For n < 0, the shifted-out bits
+    // are rounded to nearest rather than truncated, since 2^n * p
+    // is the final result. No reciprocal is needed for n < 0.
+    template<typename NegatableType>
+    NegatableType exp2_scale(const NegatableType& p, const int n)
+    {
+      typedef typename NegatableType::unsigned_small_type local_unsigned_small_type;
+      typedef typename NegatableType::value_type          local_value_type;
+      typedef typename NegatableType::nothing             local_nothing;
 
+      if(n >= 0)
       {
-        // Obtain an initial estimate of the log(x) using
-        // two terms in the Taylor series.
-        const local_negatable_type z = x - 1;
-
-        log_val = z * (1 - (z / 2));
+        return ldexp(p, n);
       }
-
-      // Use Newton-Raphson iteration to compute the log(x).
-      for(std::uint_fast16_t i = UINT16_C(1); i <= std::uint_fast16_t(local_negatable_type::all_bits / 2); i *= UINT16_C(2))
+      else if(-n > (NegatableType::radix_split + 1))
       {
-        const local_negatable_type exp_minus_log = detail::hypergeometric_0f0(-log_val);
-
-        log_val += ((x * exp_minus_log) - 1);
+        // The result is zero within the resolution.
+        return NegatableType(0U);
       }
+      else
+      {
+        const local_unsigned_small_type u(p.crepresentation());
 
-      // Obtain the result and scale it with the logarithms
-      // of the factors of 2 (if necessary).
-      result = ((n == 0) ? log_val : (log_val + (n * negatable_constants<local_negatable_type>::ln_two())));
+        return NegatableType(local_nothing(), local_value_type((u + (local_unsigned_small_type(1U) << (-n - 1))) >> -n));
+      }
     }
-    else
+
+    // Normalize x > 0 to x = m * 2^n, with 1 <= m < 2.
+    // Arguments less than 1 are shifted to the left, so that
+    // no reciprocal is needed and tiny arguments do not overflow.
+    template<typename NegatableType>
+    NegatableType log2_normalize(const NegatableType& x, int& n)
     {
-      // The argument is exactly equal to 1.
-      result = local_negatable_type(0U);
-    }
+      typedef typename NegatableType::unsigned_small_type local_unsigned_small_type;
+      typedef typename NegatableType::value_type          local_value_type;
+      typedef typename NegatableType::nothing             local_nothing;
 
-    return result;
-  }
+      // Use a binary-halving mechanism to obtain the most significant bit.
+      BOOST_CONSTEXPR_OR_CONST std::uint_fast16_t unsigned_small_digits =
+        static_cast<std::uint_fast16_t>(std::numeric_limits<local_unsigned_small_type>::digits);
 
-  /*! Computes log to base 2. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+      local_unsigned_small_type unsigned_small_mask((std::numeric_limits<local_unsigned_small_type>::max)());
 
-    return log(x) / negatable_constants<local_negatable_type>::ln_two();
-  }
+      local_unsigned_small_type tmp = static_cast<local_unsigned_small_type>(x.crepresentation());
 
-  /*! Computes log to base 10. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log10(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+      const std::uint_fast16_t msb = msb_helper(tmp, unsigned_small_mask, unsigned_small_digits);
 
-    // Consider warm-caching log(10) as a constant value.
-    return log(x) / log(local_negatable_type(10));
-  }
+      // Evaluate the necessary amount of right-shift (or left-shift if negative).
+      n = int(msb) - NegatableType::radix_split;
 
-  /*! Computes log to base a. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> loga(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> a)
-  {
-    return log(x) / log(a);
-  }
+      return NegatableType(local_nothing(), local_value_type(right_shift_helper(local_unsigned_small_type(x.crepresentation()), n)));
+    }
+  } // namespace detail
 
-  /*! Computes power x ^ a. */
+  /*! Computes exponent for fractional resolution <= 24 bits.
+      Use exp(x) = 2^(x / log(2)). The integral part of the base-2 exponent
+      is a shift, and only its fractional part needs a polynomial.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> a)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 >= (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
+    // Handle zero argument.
     if(x.crepresentation() == 0)
     {
-      return local_negatable_type(0U);
+      return local_negatable_type(1U);
     }
-    else if(a.crepresentation() == 0)
+
+    // Handle unity argument.
+    if(x == local_negatable_type(1U))
     {
-      return local_negatable_type(1U);
+      return negatable_constants<local_negatable_type>::e();
     }
-    else
+
+    if(x < -((std::numeric_limits<local_negatable_type>::max)() * negatable_constants<local_negatable_type>::ln_two()))
     {
-      return exp(a * log(x));
+      // Here, x / log(2) would overflow. Use exp(x) = exp(x / 2)^2.
+      const local_negatable_type exp_half = exp(ldexp(x, -1));
+
+      return exp_half * exp_half;
     }
+
+    int n;
+
+    const local_negatable_type f = detail::exp2_split(local_negatable_type(x * negatable_constants<local_negatable_type>::inv_ln_two()), n);
+
+    return detail::exp2_scale(detail::exp2_polynomial(f), n);
   }
 
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, int n)
+  namespace detail
   {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-
-    if(n == 0)
+    // Compute exp(r) for -log(2)/2 <= r <= +log(2)/2.
+    template<typename NegatableType>
+    NegatableType exp_wide_kernel(const NegatableType& r, std::true_type)
     {
-      return local_negatable_type(1U);
+      typedef minimax_exp<minimax_helper<NegatableType>::tier> table_type;
+
+      return minimax_helper<NegatableType>::template polynomial<table_type>(r);
     }
-    else if(n < 0)
+
+    template<typename NegatableType>
+    NegatableType exp_wide_series(const NegatableType& r, std::false_type)
     {
-      return 1 / pow(x, -n);
+      return hypergeometric_0f0(r);
     }
-    else
-    {
-      // The variable xn stores the binary powers of x.
-      local_negatable_type result(((n % 2) != 0) ? x : local_negatable_type(1U));
-
-      while((n /= 2) != 0)
-      {
-        // Square x for each binary power.
-        x *= x;
 
-        const bool has_binary_power = ((n % 2) != 0);
-
-        if(has_binary_power)
-        {
-          // Multiply the result with each binary power contained in the exponent.
-          result *= x;
-        }
-      }
+    template<typename NegatableType>
+    NegatableType exp_wide_kernel(const NegatableType& r, std::false_type)
+    {
+      typedef typename wide_exp_log_tier<NegatableType::radix_split>::use_binary_splitting use_binary_splitting;
 
-      return result;
+      return exp_wide_series(r, use_binary_splitting());
     }
-  }
+  } // namespace detail
 
-  /*! Computes sine function. */
+  /*! Computes exponent for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    // Handle zero argument.
+    if(x.crepresentation() == 0)
     {
-      return -sin(-x);
+      return local_negatable_type(1U);
     }
 
-    int n = 0;
-
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    if(x > negatable_constants<local_negatable_type>::pi())
+    if(x < -((std::numeric_limits<local_negatable_type>::max)() * negatable_constants<local_negatable_type>::ln_two()))
     {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+      // Here, x / log(2) would overflow. Use exp(x) = exp(x / 2)^2.
+      const local_negatable_type exp_half = exp(ldexp(x, -1));
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
+      return exp_half * exp_half;
     }
 
-    local_negatable_type result;
+    int nf = 0;
 
-    if(x > negatable_constants<local_negatable_type>::pi_half())
-    {
-      result = sin(negatable_constants<local_negatable_type>::pi() - x);
-    }
-    else
+    // Reduce the argument to -log(2)/2 <= x <= +log(2)/2.
+    // Negative arguments are reduced likewise, with nf < 0.
+    const local_negatable_type ln_two_half = ldexp(negatable_constants<local_negatable_type>::ln_two(), -1);
+
+    if((x > ln_two_half) || (x < -ln_two_half))
     {
-      if(x == negatable_constants<local_negatable_type>::pi_half())
+      const local_negatable_type one_half = ldexp(local_negatable_type(1U), -1);
+
+      nf = int((x * negatable_constants<local_negatable_type>::inv_ln_two()) + ((x.crepresentation() < 0) ? -one_half : one_half));
+
+      if(nf < -(local_negatable_type::radix_split + 1))
       {
-        result = local_negatable_type(1U);
+        // The result is zero within the resolution.
+        return local_negatable_type(0U);
       }
-      else
+
+      x -= (negatable_constants<local_negatable_type>::ln_two() * nf);
+    }
+
+    const local_negatable_type result =
+      detail::exp_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+
+    return detail::exp2_scale(result, nf);
+  }
+
+  namespace detail
+  {
+    // Compute expm1(x) for arguments outside of the range of the kernel,
+    // with x = r + (n * log(2)) and expm1(x) = ((expm1(r) + 1) * 2^n) - 1.
+    // Negative arguments need no reflection. Hence no division is needed
+    // and exp(-x) does not overflow.
+    template<typename NegatableType>
+    NegatableType expm1_reduced(const NegatableType& x)
+    {
+      if(x < -ldexp((std::numeric_limits<NegatableType>::max)(), -1))
       {
-        // Use a polynomial approximation.
-        // sin(x) = approx. + 0.99976073735983227 x
-        //                  - 0.16580121984779175 x^3
-        //                  + 0.00756279111686865 x^5
-        // in the range -pi/2 <= x <= +pi/2. These coefficients
-        // have been specifically derived for this work.
+        // For large negative arguments, x * (1 / log(2)) would overflow.
+        // Use expm1(x) = e * (e + 2), with e = expm1(x / 2).
+        const NegatableType e = expm1(ldexp(x, -1));
 
-        const local_negatable_type x2 = (x * x);
+        return e * (e + 2U);
+      }
 
-        // Perform the polynomial approximation using a coefficient
-        // expansion via the method of Horner.
-        result = ((       local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x000F) >> (11 + FractionalResolution)))   // 0.00756279111686865
-                   * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0153) >> (11 + FractionalResolution))))  // 0.16580121984779175
-                   * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.99976073735983227
-                   * x;
+      const NegatableType one_half = ldexp(NegatableType(1U), -1);
+
+      const int n = int((x * negatable_constants<NegatableType>::inv_ln_two()) + ((x.crepresentation() < 0) ? -one_half : one_half));
+
+      if(n < -(NegatableType::radix_split + 1))
+      {
+        // The result is -1 within the resolution.
+        return -NegatableType(1U);
       }
-    }
 
-    return (((n % 2) == 0) ? result : -result);
-  }
+      const NegatableType r = x - (negatable_constants<NegatableType>::ln_two() * n);
 
-  /*! Computes sine function for fractional resolution < 24 bits. */
+      return ldexp(expm1(r) + 1U, n) - 1U;
+    }
+  } // namespace detail
+
+  /*! Computes exp(x) - 1 for fractional resolution <= 11 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
     typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    const local_negatable_type ln_two_half = ldexp(negatable_constants<local_negatable_type>::ln_two(), -1);
+
+    if((x < -ln_two_half) || (x > ln_two_half))
     {
-      return -sin(-x);
+      return detail::expm1_reduced(x);
     }
 
-    int n = 0;
-
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    if(x > negatable_constants<local_negatable_type>::pi())
-    {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+    // Use a polynomial approximation.
+    // exp(x) - 1 = approx. x * (+ 0.9999849197
+    //                           + 0.4999899458 x
+    //                           + 0.1676702683 x^2
+    //                           + 0.0419175546 x^3),
+    // in the range -log(2)/2 <= x <= +log(2)/2. These coefficients
+    // have been specifically derived for this work.
+    return (((      local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0056) >> (11 + FractionalResolution)))   // 0.0419175546
+              * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0157) >> (11 + FractionalResolution))))  // 0.1676702683
+              * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0400) >> (11 + FractionalResolution))))  // 0.4999899458
+              * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.9999849197
+              * x;
+  }
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
-    }
+  /*! Computes exp(x) - 1 for fractional resolution <= 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    local_negatable_type result;
+    const local_negatable_type ln_two_half = ldexp(negatable_constants<local_negatable_type>::ln_two(), -1);
 
-    if(x > negatable_constants<local_negatable_type>::pi_half())
+    if((x < -ln_two_half) || (x > ln_two_half))
     {
-      result = sin(negatable_constants<local_negatable_type>::pi() - x);
+      return detail::expm1_reduced(x);
     }
-    else
-    {
-      if(x == negatable_constants<local_negatable_type>::pi_half())
-      {
-        result = local_negatable_type(1U);
-      }
-      else
-      {
-        // Use a polynomial approximation.
-        // sin(x) = approx. + 0.9999999815561047 x
-        //                  - 0.1666665066192447 x^3
-        //                  + 0.0083329484215251 x^5
-        //                  - 0.0001980373563403 x^7
-        //                  + 0.0000025959374407 x^9,
-        // in the range -pi/2 <= x <= +pi/2. These coefficients
-        // have been specifically derived for this work.
 
-        const local_negatable_type x2 = (x * x);
+    // Use a polynomial approximation.
+    // exp(x) - 1 = approx. x * (+ 0.9999999999910130
+    //                           + 0.5000000047127739 x
+    //                           + 0.1666666685368525 x^2
+    //                           + 0.0416663528635316 x^3
+    //                           + 0.0083332685803319 x^4
+    //                           + 0.0013941110648250 x^5
+    //                           + 0.0001991587165187 x^6),
+    // in the range -log(2)/2 <= x <= +log(2)/2. These coefficients
+    // have been specifically derived for this work.
+    return ((((((      local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000D0D) >> (24 + FractionalResolution)))   // 0.0001991587165187
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00005B5D) >> (24 + FractionalResolution))))  // 0.0013941110648250
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00022221) >> (24 + FractionalResolution))))  // 0.0083332685803319
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000AAAA5) >> (24 + FractionalResolution))))  // 0.0416663528635316
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAAB) >> (24 + FractionalResolution))))  // 0.1666666685368525
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00800000) >> (24 + FractionalResolution))))  // 0.5000000047127739
+                 * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 0.9999999999910130
+                 * x;
+  }
 
-        // Perform the polynomial approximation using a coefficient
-        // expansion via the method of Horner.
-        result = ((((       local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0000002B) >> (24 + FractionalResolution)))   // 0.9999999815561047
-                     * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000CFA) >> (24 + FractionalResolution))))  // 0.1666665066192447
-                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0002221B) >> (24 + FractionalResolution))))  // 0.0083329484215251
-                     * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAA7) >> (24 + FractionalResolution))))  // 0.0001980373563403
-                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFFF) >> (24 + FractionalResolution))))  // 0.0000025959374407
-                     * x;
-      }
+  namespace detail
+  {
+    // Compute expm1(r) for -log(2)/2 <= r <= +log(2)/2.
+    template<typename NegatableType>
+    NegatableType expm1_wide_kernel(const NegatableType& r, std::true_type)
+    {
+      typedef minimax_expm1<minimax_helper<NegatableType>::tier> table_type;
+
+      return r * minimax_helper<NegatableType>::template polynomial<table_type>(r);
     }
 
-    return (((n % 2) == 0) ? result : -result);
-  }
+    template<typename NegatableType>
+    NegatableType expm1_wide_kernel(const NegatableType& r, std::false_type)
+    {
+      return exp_wide_kernel(r, std::false_type()) - 1U;
+    }
+  } // namespace detail
 
-  /*! Computes sine function for fractional resolution > 24 bits. */
+  /*! Computes exp(x) - 1 for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    const local_negatable_type ln_two_half = ldexp(negatable_constants<local_negatable_type>::ln_two(), -1);
+
+    if((x < -ln_two_half) || (x > ln_two_half))
     {
-      return -sin(-x);
+      return detail::expm1_reduced(x);
     }
 
-    int n = 0;
+    return detail::expm1_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+  }
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    if(x > negatable_constants<local_negatable_type>::pi())
+  namespace detail
+  {
+    // Compute log2(1 + z) for 0 <= z < 1 and fractional resolution <= 11 bits.
+    template<typename NegatableType>
+    NegatableType log2_polynomial(const NegatableType& z,
+                                  typename std::enable_if<11 >= NegatableType::radix_split>::type const* = nullptr)
     {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
-    }
+      BOOST_CONSTEXPR_OR_CONST int right_shift = 11 - NegatableType::radix_split;
 
-    local_negatable_type result;
+      // Use a polynomial approximation of the base-2 logarithm.
+      // log2(z + 1) = approx. + 1.4385022043619629 z
+      //                       - 0.6777697968275845 z^2
+      //                       + 0.3230078286559936 z^3
+      //                       - 0.0839120707923452 z^4,
+      // in the range 0 <= z <= 1. These coefficients
+      // have been specifically derived for this work.
 
-    if(x > negatable_constants<local_negatable_type>::pi_half())
-    {
-      result = sin(negatable_constants<local_negatable_type>::pi() - x);
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      return
+        (((    - NegatableType(local_nothing(), local_value_type(UINT16_C(0x00AB) >> right_shift))   // 0.0839120707923452
+           * z + NegatableType(local_nothing(), local_value_type(UINT16_C(0x0295) >> right_shift)))  // 0.3230078286559936
+           * z - NegatableType(local_nothing(), local_value_type(UINT16_C(0x056C) >> right_shift)))  // 0.6777697968275845
+           * z + NegatableType(local_nothing(), local_value_type(UINT16_C(0x0B82) >> right_shift)))  // 1.4385022043619629
+           * z;
     }
-    else
+
+    // Compute log2(1 + z) for 0 <= z < 1 and fractional resolution <= 24 bits.
+    template<typename NegatableType>
+    NegatableType log2_polynomial(const NegatableType& z,
+                                  typename std::enable_if<(24 >= NegatableType::radix_split) && (11 < NegatableType::radix_split)>::type const* = nullptr)
     {
-      if(x <= ldexp(negatable_constants<local_negatable_type>::pi(), -2))
-      {
-        // Use the Taylor series representation of sin(x) near x = 0.
-        local_negatable_type x_squared = (x * x);
-        local_negatable_type term      = x;
-        bool term_is_negative          = true;
-        local_negatable_type sum       = term;
-
-        BOOST_CONSTEXPR_OR_CONST std::uint32_t maximum_number_of_iterations = UINT32_C(10000);
-
-        for(std::uint32_t k = UINT32_C(1); k < maximum_number_of_iterations; k += UINT32_C(2))
-        {
-          term *= x_squared;
-
-          term /= (k + 1U);
-          term /= (k + 2U);
-
-          const bool minimum_number_of_iterations_is_complete = (k > UINT32_C(5));
-
-          if(   minimum_number_of_iterations_is_complete
-             && (term <= std::numeric_limits<local_negatable_type>::epsilon()))
-          {
-            break;
-          }
-
-          ((!term_is_negative) ? sum += term : sum -= term);
-
-          term_is_negative = (!term_is_negative);
-        }
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
 
-        result = sum;
-      }
-      else
-      {
-        // Use an angle-doubling identity to reduce the argument to less than +pi/4.
-        const local_negatable_type half_x = x / 2;
+      BOOST_CONSTEXPR_OR_CONST int right_shift = 24 - NegatableType::radix_split;
 
-        const local_negatable_type sin_half_x = sin(half_x);
+      // Use a polynomial approximation of the base-2 logarithm.
+      // log2(z + 1) = approx. + 1.44265859709491 z
+      //                       - 0.72044516000712 z^2
+      //                       + 0.47280304531019 z^3
+      //                       - 0.32400619521798 z^4
+      //                       + 0.19183861358090 z^5
+      //                       - 0.07798258678209 z^6
+      //                       + 0.01513421407398 z^7,
+      // in the range 0 <= z <= 1. These coefficients
+      // have been specifically derived for this work.
 
-        result = (2 * (sin(half_x) * cos(half_x)));
-      }
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      return
+        ((((((      NegatableType(local_nothing(), local_value_type(UINT32_C(0x0003DFD5) >> right_shift))   // 0.01513421407398
+              * z - NegatableType(local_nothing(), local_value_type(UINT32_C(0x0013F6AA) >> right_shift)))  // 0.07798258678209
+              * z + NegatableType(local_nothing(), local_value_type(UINT32_C(0x00311C55) >> right_shift)))  // 0.19183861358090
+              * z - NegatableType(local_nothing(), local_value_type(UINT32_C(0x0052F211) >> right_shift)))  // 0.32400619521798
+              * z + NegatableType(local_nothing(), local_value_type(UINT32_C(0x0079099E) >> right_shift)))  // 0.47280304531019
+              * z - NegatableType(local_nothing(), local_value_type(UINT32_C(0x00B86F18) >> right_shift)))  // 0.72044516000712
+              * z + NegatableType(local_nothing(), local_value_type(UINT32_C(0x01715212) >> right_shift)))  // 1.44265859709491
+              * z;
     }
+  } // namespace detail
 
-    return (((n % 2) == 0) ? result : -result);
-  }
-
-  /*! Computes cosine function for fractional resolution < 11 bits. */
+  /*! Computes natural log for fractional resolution <= 24 bits.
+      Use log(x) = (log2(m) + n) * log(2), with x = m * 2^n and 1 <= m < 2.
+      The integral part n of the base-2 logarithm is the position
+      of the most significant bit, and only log2(m) needs a polynomial.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 >= (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    if(x.crepresentation() <= 0)
     {
-      x = -x;
+      return -(std::numeric_limits<local_negatable_type>::max)();
     }
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    int n = 0;
-
-    if(x >= negatable_constants<local_negatable_type>::pi())
-    {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+    int n;
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
-    }
+    const local_negatable_type m = detail::log2_normalize(x, n);
 
-    local_negatable_type result;
+    // Scale the base-2 logarithm to a base-e logarithm.
+    const local_negatable_type log_value = detail::log2_polynomial(local_negatable_type(m - 1U)) * negatable_constants<local_negatable_type>::ln_two();
 
-    const local_negatable_type delta = negatable_constants<local_negatable_type>::pi_half() - x;
+    // Scale with the logarithms of the powers of 2 if necessary.
+    return ((n == 0) ? log_value : (log_value + (negatable_constants<local_negatable_type>::ln_two() * n)));
+  }
 
-    if(fabs(delta) < ldexp(local_negatable_type(1U), -2))
+  namespace detail
+  {
+    // Compute log(x) for 1 < x <= 2. An additional power of two
+    // may be split off and added to n.
+    template<typename NegatableType>
+    NegatableType log_wide_kernel(const NegatableType& x, int& n, std::true_type)
     {
-      const local_negatable_type delta2 = (delta * delta);
+      typedef minimax_log<minimax_helper<NegatableType>::tier> table_type;
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      result = ((         + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0011) >> (11 + FractionalResolution)))   // 0.9999999815561047
-                 * delta2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0155) >> (11 + FractionalResolution))))  // 0.1666665066192447
-                 * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.1666665066192447
-                 * delta;
-    }
-    else if(x > negatable_constants<local_negatable_type>::pi_half())
-    {
-      if(x == negatable_constants<local_negatable_type>::pi())
+      // Use log(x) = 2 * atanh(s), with s = (x - 1) / (x + 1) and |s| <= 3 - 2 sqrt(2).
+      // For x > sqrt(2), use x/2 instead, for which s = (x - 2) / (x + 2).
+      NegatableType s;
+
+      if(x > negatable_constants<NegatableType>::root_two())
       {
-        result = local_negatable_type(-1);
+        s = (x - 2U) / (x + 2U);
+
+        ++n;
       }
       else
       {
-        result = -cos(negatable_constants<local_negatable_type>::pi() - x);
+        s = (x - 1U) / (x + 1U);
       }
+
+      return (s * minimax_helper<NegatableType>::template polynomial<table_type>(s * s)) * std::integral_constant<unsigned, 2U>();
     }
-    else
+
+    template<typename NegatableType>
+    NegatableType log_wide_iteration(const NegatableType& x, std::false_type)
     {
-      if(x.crepresentation() == 0)
-      {
-        result = local_negatable_type(1U);
-      }
-      else if(x == negatable_constants<local_negatable_type>::pi_half())
+      NegatableType log_val;
+
       {
-        result = local_negatable_type(0U);
+        // Obtain an initial estimate of the log(x) using
+        // two terms in the Taylor series.
+        const NegatableType z = x - 1;
+
+        log_val = z * (1 - (z / 2));
       }
-      else
-      {
-        // Use a polynomial approximation.
-        // cos(x) = approx. + 0.99999499214619638
-        //                  - 0.49992775493529621 x^2
-        //                  + 0.04150705495821635 x^4
-        //                  - 0.00127707709747365 x^6
-        // in the range -pi/2 <= x <= +pi/2. These coefficients
-        // have been specifically derived for this work.
 
-        const local_negatable_type x2 = (x * x);
+      // Use Newton-Raphson iteration to compute the log(x).
+      for(std::uint_fast16_t i = UINT16_C(1); i <= std::uint_fast16_t(NegatableType::all_bits / 2); i *= UINT16_C(2))
+      {
+        const NegatableType exp_minus_log = hypergeometric_0f0(-log_val);
 
-        // Perform the polynomial approximation using a coefficient
-        // expansion via the method of Horner.
-        result = (((     - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0002) >> (11 + FractionalResolution)))    // 0.99999499214619638
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0055) >> (11 + FractionalResolution))))   // 0.49992775493529621
-                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x03FF) >> (11 + FractionalResolution))))   // 0.04150705495821635
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))));  // 0.00127707709747365
+        log_val += ((x * exp_minus_log) - 1);
       }
+
+      return log_val;
     }
 
-    return (((n % 2) == 0) ? result : -result);
-  }
+    template<typename NegatableType>
+    NegatableType log_wide_kernel(const NegatableType& x, int&, std::false_type)
+    {
+      typedef typename wide_exp_log_tier<NegatableType::radix_split>::use_agm use_agm;
 
-  /*! Computes cosine function for fractional resolution < 24 bits. */
+      return log_wide_iteration(x, use_agm());
+    }
+  } // namespace detail
+
+  /*! Computes natural log for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    if(x.crepresentation() <= 0)
     {
-      x = -x;
+      return -(std::numeric_limits<local_negatable_type>::max)();
     }
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    int n = 0;
+    // Normalize the argument to x = m * 2^n, with 1 <= m < 2.
+    int n;
+
+    const local_negatable_type m = detail::log2_normalize(x, n);
 
-    if(x >= negatable_constants<local_negatable_type>::pi())
-    {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+    const local_negatable_type log_val =
+      detail::log_wide_kernel(m, n, typename detail::minimax_helper<local_negatable_type>::is_available());
+
+    // Obtain the result and scale it with the logarithms
+    // of the factors of 2 (if necessary).
+    return ((n == 0) ? log_val : (log_val + (negatable_constants<local_negatable_type>::ln_two() * n)));
+  }
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
+  namespace detail
+  {
+    // Compute log2(m) for 1 <= m < 2 with the polynomials.
+    template<typename NegatableType>
+    NegatableType log2_fraction(const NegatableType& m, int&, std::true_type)
+    {
+      return log2_polynomial(NegatableType(m - 1U));
     }
 
-    local_negatable_type result;
+    // Compute log2(m) for 1 <= m < 2 with the kernel of log.
+    // An additional power of two may be split off and added to n.
+    template<typename NegatableType>
+    NegatableType log2_fraction(const NegatableType& m, int& n, std::false_type)
+    {
+      const NegatableType log_m = log_wide_kernel(m, n, typename minimax_helper<NegatableType>::is_available());
 
-    const local_negatable_type delta = negatable_constants<local_negatable_type>::pi_half() - x;
+      return log_m * negatable_constants<NegatableType>::inv_ln_two();
+    }
 
-    if(fabs(delta) < ldexp(local_negatable_type(1U), -2))
+    // Compute 2^f for -1/2 <= f <= +1/2 with the polynomials.
+    template<typename NegatableType>
+    NegatableType exp2_fraction(const NegatableType& f, std::true_type)
     {
-      const local_negatable_type delta2 = (delta * delta);
+      return exp2_polynomial(f);
+    }
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      result = (((         - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000D00) >> (24 + FractionalResolution)))   // 0.9999999815561047
-                  * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00022222) >> (24 + FractionalResolution))))  // 0.1666665066192447
-                  * delta2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAAA) >> (24 + FractionalResolution))))  // 0.1666665066192447
-                  * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 0.0000025959374407
-                  * delta;
+    // Compute 2^f for -1/2 <= f <= +1/2 with the kernel of exp.
+    template<typename NegatableType>
+    NegatableType exp2_fraction(const NegatableType& f, std::false_type)
+    {
+      const NegatableType r = f * negatable_constants<NegatableType>::ln_two();
+
+      return exp_wide_kernel(r, typename minimax_helper<NegatableType>::is_available());
     }
-    else if(x > negatable_constants<local_negatable_type>::pi_half())
+  } // namespace detail
+
+  namespace detail
+  {
+    // Compute log1p(x) for arguments outside of the range of the kernel.
+    // For x > 1, use log1p(x) = log((x / 2) + (1 / 2)) + log(2), for which 1 + x does not overflow.
+    template<typename NegatableType>
+    NegatableType log1p_reduced(const NegatableType& x)
     {
-      if(x == negatable_constants<local_negatable_type>::pi())
+      NegatableType result;
+
+      if(x > 1)
       {
-        result = local_negatable_type(-1);
+        result = log(ldexp(x, -1) + ldexp(NegatableType(1U), -1)) + negatable_constants<NegatableType>::ln_two();
       }
       else
       {
-        result = -cos(negatable_constants<local_negatable_type>::pi() - x);
+        result = log(1 + x);
       }
+
+      return result;
     }
-    else
+
+    // Query if the argument of log1p lies in the range of the kernel,
+    // 1/sqrt(2) - 1 <= x <= sqrt(2) - 1, for which log1p(x) = 2 atanh(s),
+    // with s = x / (2 + x) and |s| <= 3 - 2 sqrt(2).
+    template<typename NegatableType>
+    bool log1p_is_kernel_argument(const NegatableType& x)
     {
-      if(x.crepresentation() == 0)
-      {
-        result = local_negatable_type(1U);
-      }
-      else if(x == negatable_constants<local_negatable_type>::pi_half())
-      {
-        result = local_negatable_type(0U);
-      }
-      else
-      {
-        // Use a polynomial approximation.
-        // cos(x) = approx. + 0.9999999998329485
-        //                  - 0.4999999947816307 x^2
-        //                  + 0.0416666405328244 x^4
-        //                  - 0.0013888413877237 x^6
-        //                  + 0.0000247627549571 x^8
-        //                  - 0.0000002609587957 x^10
-        // in the range -pi/2 <= x <= +pi/2. These coefficients
-        // have been specifically derived for this work.
+      return (   (x >= (ldexp(negatable_constants<NegatableType>::root_two(), -1) - 1U))
+              && (x <= (negatable_constants<NegatableType>::root_two() - 1U)));
+    }
+  } // namespace detail
 
-        const local_negatable_type x2 = (x * x);
+  /*! Computes log(1 + x) for fractional resolution <= 11 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-        // Perform the polynomial approximation using a coefficient
-        // expansion via the method of Horner.
-        result = (((((     - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000003) >> (24 + FractionalResolution)))    // 0.00000022171564942
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000196) >> (24 + FractionalResolution))))   // 0.00002424851890444
-                      * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00005AD9) >> (24 + FractionalResolution))))   // 0.00138624146943166
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000AAA4a) >> (24 + FractionalResolution))))   // 0.04166094016112324
-                      * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x007FFFB4) >> (24 + FractionalResolution))))   // 0.49999549949242657
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFF6) >> (24 + FractionalResolution))));  // 0.99999943833186084
-      }
+    if(!detail::log1p_is_kernel_argument(x))
+    {
+      return detail::log1p_reduced(x);
     }
 
-    return (((n % 2) == 0) ? result : -result);
+    const local_negatable_type s  = x / (2U + x);
+    const local_negatable_type s2 = (s * s);
+
+    // Use a polynomial approximation.
+    // atanh(s) = approx. s * (+ 0.9999776336
+    //                         + 0.3393474811 s^2),
+    // in the range 0 <= s <= 3 - 2 sqrt(2). These coefficients
+    // have been specifically derived for this work.
+    return ((      local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x02B7) >> (11 + FractionalResolution)))   // 0.3393474811
+             * s2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.9999776336
+             * s) * std::integral_constant<unsigned, 2U>();
   }
 
-  /*! Computes cosine function for fractional resolution > 24 bits. */
+  /*! Computes log(1 + x) for fractional resolution <= 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle reflection for negative arguments.
-    if(x.crepresentation() < 0)
+    if(!detail::log1p_is_kernel_argument(x))
     {
-      x = -x;
+      return detail::log1p_reduced(x);
     }
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    int n = 0;
+    const local_negatable_type s  = x / (2U + x);
+    const local_negatable_type s2 = (s * s);
 
-    if(x > negatable_constants<local_negatable_type>::pi())
+    // Use a polynomial approximation.
+    // atanh(s) = approx. s * (+ 0.9999999993072205
+    //                         + 0.3333340818599627 s^2
+    //                         + 0.1998737838945025 s^4
+    //                         + 0.1496325726858195 s^6),
+    // in the range 0 <= s <= 3 - 2 sqrt(2). These coefficients
+    // have been specifically derived for this work.
+    return ((((     local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00264E52) >> (24 + FractionalResolution)))   // 0.1496325726858195
+                * s2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00332AEE) >> (24 + FractionalResolution))))  // 0.1998737838945025
+                * s2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00555562) >> (24 + FractionalResolution))))  // 0.3333340818599627
+                * s2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 0.9999999993072205
+                * s) * std::integral_constant<unsigned, 2U>();
+  }
+
+  namespace detail
+  {
+    // Compute log1p(x) for 1/sqrt(2) - 1 <= x <= sqrt(2) - 1 with the
+    // minimax polynomial of the kernel of log.
+    template<typename NegatableType>
+    NegatableType log1p_wide_kernel(const NegatableType& x, std::true_type)
     {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+      typedef minimax_log<minimax_helper<NegatableType>::tier> table_type;
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
-    }
+      const NegatableType s = x / (2U + x);
 
-    local_negatable_type result;
+      return (s * minimax_helper<NegatableType>::template polynomial<table_type>(s * s)) * std::integral_constant<unsigned, 2U>();
+    }
 
-    if(x > negatable_constants<local_negatable_type>::pi_half())
+    template<typename NegatableType>
+    NegatableType log1p_wide_kernel(const NegatableType& x, std::false_type)
     {
-      result = -cos(negatable_constants<local_negatable_type>::pi() - x);
+      return log(1 + x);
     }
-    else
-    {
-      if(x <= ldexp(negatable_constants<local_negatable_type>::pi(), -2))
-      {
-        // Use the Taylor series representation of cos(x) near x = 0.
-        local_negatable_type x_squared = (x * x);
-        local_negatable_type term      = x_squared / 2;
-        bool term_is_negative          = false;
-        local_negatable_type sum       = 1 - term;
+  } // namespace detail
+
+  /*! Computes log(1 + x) for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
-        BOOST_CONSTEXPR_OR_CONST std::uint32_t maximum_number_of_iterations = UINT32_C(10000);
+    if(!detail::log1p_is_kernel_argument(x))
+    {
+      return detail::log1p_reduced(x);
+    }
 
-        for(std::uint32_t k = UINT32_C(2); k < maximum_number_of_iterations; k += UINT32_C(2))
-        {
-          term *= x_squared;
+    return detail::log1p_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+  }
 
-          term /= (k + 1U);
-          term /= (k + 2U);
+  /*! Computes log to base 2.
+      The integral part of the result is the position of the most significant bit,
+      and only the logarithm of the normalized fraction needs to be approximated.
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
-          const bool minimum_number_of_iterations_is_complete = (k > UINT32_C(6));
+    if(x.crepresentation() <= 0)
+    {
+      return -(std::numeric_limits<local_negatable_type>::max)();
+    }
 
-          if(   (minimum_number_of_iterations_is_complete)
-             && (term <= std::numeric_limits<local_negatable_type>::epsilon()))
-          {
-            break;
-          }
+    int n;
 
-          ((!term_is_negative) ? sum += term : sum -= term);
+    const local_negatable_type m = detail::log2_normalize(x, n);
 
-          term_is_negative = (!term_is_negative);
-        }
+    const local_negatable_type log2_m = detail::log2_fraction(m, n, std::integral_constant<bool, (24 >= (-FractionalResolution))>());
 
-        result = sum;
-      }
-      else
-      {
-        // Use an angle-doubling identity to reduce the argument to less than +pi/4.
-        const local_negatable_type half_x = x / 2;
+    return ((n == 0) ? log2_m : (log2_m + n));
+  }
 
-        const local_negatable_type cos_half_x = cos(half_x);
+  /*! Computes log to base 10. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log10(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
-        result = (2 * (cos_half_x * cos_half_x)) - 1;
-      }
-    }
+    return log(x) * negatable_constants<local_negatable_type>::inv_ln_ten();
+  }
 
-    return (((n % 2) == 0) ? result : -result);
+  /*! Computes log to base a. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> loga(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> a)
+  {
+    return log(x) / log(a);
   }
 
-  /*! Computes tangent function for fractional resolution < 11 bits. */
+  /*! Computes 2 raised to the power x.
+      The integral part n of x is a shift, and only 2^f, with x = n + f
+      and -1/2 <= f <= +1/2, needs to be approximated.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle negative arguments, zero argument and argument pi/2.
-    if(x.crepresentation() < 0)
+    // Handle zero argument.
+    if(x.crepresentation() == 0)
     {
-      return -tan(-x);
+      return local_negatable_type(1U);
     }
-    else if(x.crepresentation() == 0)
+
+    int n;
+
+    const local_negatable_type f = detail::exp2_split(x, n);
+
+    if(n < -(local_negatable_type::radix_split + 1))
     {
+      // The result is zero within the resolution.
       return local_negatable_type(0U);
     }
-    else if(x == negatable_constants<local_negatable_type>::pi_half())
+
+    const local_negatable_type exp2_f = detail::exp2_fraction(f, std::integral_constant<bool, (24 >= (-FractionalResolution))>());
+
+    return detail::exp2_scale(exp2_f, n);
+  }
+
+  /*! Computes power x ^ a.
+      Exponents of 1/2 use the square root, and integral exponents
+      use binary powers. Otherwise x^a = 2^(a * log2(x)) is used,
+      with log2(x) = n + log2(m), where a * n is multiplied
+      with the integer n and does not overflow.
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> a)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(x.crepresentation() == 0)
     {
-      return (std::numeric_limits<local_negatable_type>::max)();
+      return local_negatable_type(0U);
+    }
+    else if(a.crepresentation() == 0)
+    {
+      return local_negatable_type(1U);
+    }
+    else if(a == ldexp(local_negatable_type(1U), -1))
+    {
+      return sqrt(x);
+    }
+
+    int a_exp;
+
+    frexp(a, &a_exp);
+
+    if((a_exp <= 15) && (a == floor(a)))
+    {
+      // The exponent is an integer with |a| < 2^15.
+      return pow(x, int(a));
+    }
+    else if(x.crepresentation() < 0)
+    {
+      // The result of a negative base with a non-integral exponent
+      // is not a real number.
+      return local_negatable_type(0U);
+    }
+    else
+    {
+      int n;
+
+      const local_negatable_type m      = detail::log2_normalize(x, n);
+      const local_negatable_type log2_m = detail::log2_fraction(m, n, std::integral_constant<bool, (24 >= (-FractionalResolution))>());
+
+      return exp2(local_negatable_type((a * log2_m) + (a * n)));
+    }
+  }
+
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, int n)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(n == 0)
+    {
+      return local_negatable_type(1U);
+    }
+    else if(n < 0)
+    {
+      // For |x| >= 1, use (1 / x)^-n, for which x^-n need not be representable.
+      return ((fabs(x) >= 1) ? pow(local_negatable_type(1 / x), -n) : (1 / pow(x, -n)));
+    }
+    else
+    {
+      // The variable xn stores the binary powers of x.
+      local_negatable_type result(((n % 2) != 0) ? x : local_negatable_type(1U));
+
+      while((n /= 2) != 0)
+      {
+        // Square x for each binary power.
+        x *= x;
+
+        const bool has_binary_power = ((n % 2) != 0);
+
+        if(has_binary_power)
+        {
+          // Multiply the result with each binary power contained in the exponent.
+          result *= x;
+        }
+      }
+
+      return result;
     }
+  }
+
+  /*! Computes sine function. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    int n = 0;
+    // Handle reflection for negative arguments.
+    if(x.crepresentation() < 0)
+    {
+      return -sin(-x);
+    }
 
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use sin(x) = +-sin(r) or +-cos(r), depending on the quadrant.
     if(x > negatable_constants<local_negatable_type>::pi())
     {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+      local_negatable_type r;
+
+      const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+      const local_negatable_type result = (((q % 2U) == 0U) ? sin(r) : cos(r));
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
+      return ((q >= 2U) ? -result : result);
     }
 
     local_negatable_type result;
 
     if(x > negatable_constants<local_negatable_type>::pi_half())
     {
-      result = -tan(negatable_constants<local_negatable_type>::pi() - x);
+      result = sin(negatable_constants<local_negatable_type>::pi() - x);
     }
     else
     {
-      const local_negatable_type pi_over_four = negatable_constants<local_negatable_type>::pi() / 4;
-
-      if(x > pi_over_four)
+      if(x == negatable_constants<local_negatable_type>::pi_half())
       {
-        const local_negatable_type tan_value_shifted = tan(x - pi_over_four);
-
-        result = (1 + tan_value_shifted) / (1 - tan_value_shifted);
+        result = local_negatable_type(1U);
       }
-      else if(x < pi_over_four)
+      else
       {
         // Use a polynomial approximation.
-        // tan(x) / x = approx. + 0.999966509199007
-        //                      + 0.335162805277695 x^2
-        //                      + 0.118177026215436 x^4
-        //                      + 0.091380425311140 x^6,
-        // in the range 0 <= x <= +pi/4. These coefficients
+        // sin(x) = approx. + 0.99976073735983227 x
+        //                  - 0.16580121984779175 x^3
+        //                  + 0.00756279111686865 x^5
+        // in the range -pi/2 <= x <= +pi/2. These coefficients
         // have been specifically derived for this work.
 
         const local_negatable_type x2 = (x * x);
 
         // Perform the polynomial approximation using a coefficient
         // expansion via the method of Horner.
-        result = (((       local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x00BB) >> (11 + FractionalResolution)))   // 0.01987397353189
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x00F2) >> (11 + FractionalResolution))))  // 0.01326787053456
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x02AE) >> (11 + FractionalResolution))))  // 0.33335465351938
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.99999982053522
-                    * x;
-      }
-      else
-      {
-        // The argument is exactly +pi/4.
-        result = local_negatable_type(1U);
+        result = ((       local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x000F) >> (11 + FractionalResolution)))   // 0.00756279111686865
+                   * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0153) >> (11 + FractionalResolution))))  // 0.16580121984779175
+                   * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.99976073735983227
+                   * x;
       }
     }
 
     return result;
   }
 
-  /*! Computes tangent function for fractional resolution < 24 bits. */
+  /*! Computes sine function for fractional resolution < 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
     typedef typename local_negatable_type::nothing                                  local_nothing;
 
-    // Handle negative arguments, zero argument and argument pi/2.
+    // Handle reflection for negative arguments.
     if(x.crepresentation() < 0)
     {
-      return -tan(-x);
-    }
-    else if(x.crepresentation() == 0)
-    {
-      return local_negatable_type(0U);
-    }
-    else if(x == negatable_constants<local_negatable_type>::pi_half())
-    {
-      return (std::numeric_limits<local_negatable_type>::max)();
+      return -sin(-x);
     }
 
-    // Reduce the argument to the range 0 <= x <= +pi/2.
-    int n = 0;
-
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use sin(x) = +-sin(r) or +-cos(r), depending on the quadrant.
     if(x > negatable_constants<local_negatable_type>::pi())
     {
-      n = int(x / negatable_constants<local_negatable_type>::pi());
+      local_negatable_type r;
+
+      const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
 
-      x -= (n * negatable_constants<local_negatable_type>::pi());
+      const local_negatable_type result = (((q % 2U) == 0U) ? sin(r) : cos(r));
+
+      return ((q >= 2U) ? -result : result);
     }
 
     local_negatable_type result;
 
     if(x > negatable_constants<local_negatable_type>::pi_half())
     {
-      result = -tan(negatable_constants<local_negatable_type>::pi() - x);
+      result = sin(negatable_constants<local_negatable_type>::pi() - x);
     }
     else
     {
-      const local_negatable_type pi_over_four = negatable_constants<local_negatable_type>::pi() / 4;
-
-      if(x > pi_over_four)
+      if(x == negatable_constants<local_negatable_type>::pi_half())
       {
-        const local_negatable_type tan_value_shifted = tan(x - pi_over_four);
-
-        result = (1 + tan_value_shifted) / (1 - tan_value_shifted);
+        result = local_negatable_type(1U);
       }
-      else if(x < pi_over_four)
+      else
       {
         // Use a polynomial approximation.
-        // tan(x) / x = approx. + 0.99999982053522
-        //                      + 0.33335465351938 x^2
-        //                      + 0.13292151590120 x^4
-        //                      + 0.05681862499001 x^6
-        //                      + 0.01326787053456 x^8
-        //                      + 0.01987397353189 x^10,
-        // in the range 0 <= x <= +pi/4. These coefficients
+        // sin(x) = approx. + 0.9999999815561047 x
+        //                  - 0.1666665066192447 x^3
+        //                  + 0.0083329484215251 x^5
+        //                  - 0.0001980373563403 x^7
+        //                  + 0.0000025959374407 x^9,
+        // in the range -pi/2 <= x <= +pi/2. These coefficients
         // have been specifically derived for this work.
 
         const local_negatable_type x2 = (x * x);
 
         // Perform the polynomial approximation using a coefficient
         // expansion via the method of Horner.
-        result = (((((       local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00051675) >> (24 + FractionalResolution)))   // 0.01987397353189
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00036585) >> (24 + FractionalResolution))))  // 0.01326787053456
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000E8BAA) >> (24 + FractionalResolution))))  // 0.05681862499001
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00220724) >> (24 + FractionalResolution))))  // 0.13292151590120
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x005556BB) >> (24 + FractionalResolution))))  // 0.33335465351938
-                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFFC) >> (24 + FractionalResolution))))  // 0.99999982053522
-                      * x;
+        result = ((((       local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0000002B) >> (24 + FractionalResolution)))   // 0.9999999815561047
+                     * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000CFA) >> (24 + FractionalResolution))))  // 0.1666665066192447
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0002221B) >> (24 + FractionalResolution))))  // 0.0083329484215251
+                     * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAA7) >> (24 + FractionalResolution))))  // 0.0001980373563403
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFFF) >> (24 + FractionalResolution))))  // 0.0000025959374407
+                     * x;
       }
-      else
+    }
+
+    return result;
+  }
+
+  namespace detail
+  {
+    /*! Helper for sine and cosine with fractional resolution > 24 bits.
+        It provides kernels for sin(r) and cos(r) in the range -pi/4 <= r <= +pi/4.
+        These use the minimax polynomials of the resolution tier of the type if
+        available, and otherwise Taylor series whose reciprocal-factorial
+        coefficients are precomputed once per type.
+    */
+    template<typename NegatableType>
+    struct sin_cos_wide_helper
+    {
+      typedef typename NegatableType::float_type float_type;
+
+      BOOST_STATIC_CONSTEXPR int radix_split = NegatableType::radix_split;
+
+      typedef typename minimax_helper<NegatableType>::is_available minimax_is_available;
+
+      /*! Compute sin(r) for -pi/4 <= r <= +pi/4.\n
+      */
+      static NegatableType sin_kernel(const NegatableType& r)
       {
-        // The argument is exactly +pi/4.
-        result = local_negatable_type(1U);
+        return sin_kernel(r, minimax_is_available());
+      }
+
+      /*! Compute cos(r) for -pi/4 <= r <= +pi/4.\n
+      */
+      static NegatableType cos_kernel(const NegatableType& r)
+      {
+        return cos_kernel(r, minimax_is_available());
+      }
+
+    private:
+      static NegatableType sin_kernel(const NegatableType& r, std::true_type)
+      {
+        typedef minimax_sin<minimax_helper<NegatableType>::tier> table_type;
+
+        return minimax_helper<NegatableType>::template polynomial<table_type>(r * r) * r;
+      }
+
+      static NegatableType cos_kernel(const NegatableType& r, std::true_type)
+      {
+        typedef minimax_cos<minimax_helper<NegatableType>::tier> table_type;
+
+        return minimax_helper<NegatableType>::template polynomial<table_type>(r * r);
+      }
+
+      // Use the method of Horner in r^2 for the Taylor series.
+      static NegatableType sin_kernel(const NegatableType& r, std::false_type)
+      {
+        const std::vector<NegatableType>& c = coefficients();
+
+        const NegatableType r2 = (r * r);
+
+        // Begin with the largest odd index.
+        std::size_t k = (((c.size() % 2U) == 0U) ? (c.size() - 1U) : (c.size() - 2U));
+
+        NegatableType sum = c[k];
+
+        while(k > 1U)
+        {
+          k -= 2U;
+
+          sum = (sum * r2) + c[k];
+        }
+
+        return sum * r;
+      }
+
+      static NegatableType cos_kernel(const NegatableType& r, std::false_type)
+      {
+        const std::vector<NegatableType>& c = coefficients();
+
+        const NegatableType r2 = (r * r);
+
+        // Begin with the largest even index.
+        std::size_t k = (((c.size() % 2U) == 0U) ? (c.size() - 2U) : (c.size() - 1U));
+
+        NegatableType sum = c[k];
+
+        while(k > 0U)
+        {
+          k -= 2U;
+
+          sum = (sum * r2) + c[k];
+        }
+
+        return sum;
+      }
+
+      static const std::vector<NegatableType>& coefficients()
+      {
+        static const std::vector<NegatableType> the_coefficients = make_coefficients();
+
+        return the_coefficients;
       }
+
+      static std::vector<NegatableType> make_coefficients()
+      {
+        // Compute the Taylor coefficients c_k = (-1)^(k/2) / k!, in which the odd
+        // indices belong to sin(r) and the even indices belong to cos(r).
+        // The series are truncated when 1/k! falls below the resolution.
+        // Since |r| <= pi/4, the neglected terms are then well below 1/2 ulp.
+        using std::ldexp;
+
+        const float_type tolerance = ldexp(float_type(1U), -radix_split);
+
+        std::vector<NegatableType> c;
+
+        float_type reciprocal_factorial(1U);
+
+        for(std::uint32_t k = UINT32_C(0); ; ++k)
+        {
+          if(k > UINT32_C(0))
+          {
+            reciprocal_factorial /= k;
+          }
+
+          const bool minimum_number_of_terms_is_complete = (k > UINT32_C(3));
+
+          if(minimum_number_of_terms_is_complete && (reciprocal_factorial < tolerance))
+          {
+            break;
+          }
+
+          const NegatableType ck(reciprocal_factorial);
+
+          c.push_back((((k / 2U) % 2U) == 0U) ? ck : -ck);
+        }
+
+        return c;
+      }
+    };
+  } // namespace detail
+
+  /*! Computes sine function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::sin_cos_wide_helper<local_negatable_type>                      local_helper_type;
+
+    // Handle reflection for negative arguments.
+    const bool x_is_neg = (x.crepresentation() < 0);
+
+    if(x_is_neg)
+    {
+      x = -x;
     }
 
+    // Reduce the argument to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4.
+    local_negatable_type r;
+
+    const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+    // Select the kernel and the sign of the result from the quadrant q = (n mod 4).
+    const local_negatable_type result = (((q % 2U) == 0U) ? local_helper_type::sin_kernel(r)
+                                                          : local_helper_type::cos_kernel(r));
+
+    return (((q >= 2U) != x_is_neg) ? -result : result);
+  }
+
+  /*! Computes cosine function for fractional resolution < 11 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    // Handle reflection for negative arguments.
+    if(x.crepresentation() < 0)
+    {
+      x = -x;
+    }
+
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use cos(x) = sin(x + pi/2) = +-sin(r) or +-cos(r), depending on the quadrant.
+    if(x > negatable_constants<local_negatable_type>::pi())
+    {
+      local_negatable_type r;
+
+      const std::uint_fast8_t q =
+        static_cast<std::uint_fast8_t>((detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r) + 1U) % 4U);
+
+      const local_negatable_type result = (((q % 2U) == 0U) ? sin(r) : cos(r));
+
+      return ((q >= 2U) ? -result : result);
+    }
+
+    local_negatable_type result;
+
+    const local_negatable_type delta = negatable_constants<local_negatable_type>::pi_half() - x;
+
+    if(fabs(delta) < ldexp(local_negatable_type(1U), -2))
+    {
+      const local_negatable_type delta2 = (delta * delta);
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      result = ((         + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0011) >> (11 + FractionalResolution)))   // 0.9999999815561047
+                 * delta2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0155) >> (11 + FractionalResolution))))  // 0.1666665066192447
+                 * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.1666665066192447
+                 * delta;
+    }
+    else if(x > negatable_constants<local_negatable_type>::pi_half())
+    {
+      if(x == negatable_constants<local_negatable_type>::pi())
+      {
+        result = local_negatable_type(-1);
+      }
+      else
+      {
+        result = -cos(negatable_constants<local_negatable_type>::pi() - x);
+      }
+    }
+    else
+    {
+      if(x.crepresentation() == 0)
+      {
+        result = local_negatable_type(1U);
+      }
+      else if(x == negatable_constants<local_negatable_type>::pi_half())
+      {
+        result = local_negatable_type(0U);
+      }
+      else
+      {
+        // Use a polynomial approximation.
+        // cos(x) = approx. + 0.99999499214619638
+        //                  - 0.49992775493529621 x^2
+        //                  + 0.04150705495821635 x^4
+        //                  - 0.00127707709747365 x^6
+        // in the range -pi/2 <= x <= +pi/2. These coefficients
+        // have been specifically derived for this work.
+
+        const local_negatable_type x2 = (x * x);
+
+        // Perform the polynomial approximation using a coefficient
+        // expansion via the method of Horner.
+        result = (((     - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0002) >> (11 + FractionalResolution)))    // 0.99999499214619638
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0055) >> (11 + FractionalResolution))))   // 0.49992775493529621
+                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x03FF) >> (11 + FractionalResolution))))   // 0.04150705495821635
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))));  // 0.00127707709747365
+      }
+    }
+
+    return result;
+  }
+
+  /*! Computes cosine function for fractional resolution < 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    // Handle reflection for negative arguments.
+    if(x.crepresentation() < 0)
+    {
+      x = -x;
+    }
+
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use cos(x) = sin(x + pi/2) = +-sin(r) or +-cos(r), depending on the quadrant.
+    if(x > negatable_constants<local_negatable_type>::pi())
+    {
+      local_negatable_type r;
+
+      const std::uint_fast8_t q =
+        static_cast<std::uint_fast8_t>((detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r) + 1U) % 4U);
+
+      const local_negatable_type result = (((q % 2U) == 0U) ? sin(r) : cos(r));
+
+      return ((q >= 2U) ? -result : result);
+    }
+
+    local_negatable_type result;
+
+    const local_negatable_type delta = negatable_constants<local_negatable_type>::pi_half() - x;
+
+    if(fabs(delta) < ldexp(local_negatable_type(1U), -2))
+    {
+      const local_negatable_type delta2 = (delta * delta);
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      result = (((         - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000D00) >> (24 + FractionalResolution)))   // 0.9999999815561047
+                  * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00022222) >> (24 + FractionalResolution))))  // 0.1666665066192447
+                  * delta2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAAA) >> (24 + FractionalResolution))))  // 0.1666665066192447
+                  * delta2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 0.0000025959374407
+                  * delta;
+    }
+    else if(x > negatable_constants<local_negatable_type>::pi_half())
+    {
+      if(x == negatable_constants<local_negatable_type>::pi())
+      {
+        result = local_negatable_type(-1);
+      }
+      else
+      {
+        result = -cos(negatable_constants<local_negatable_type>::pi() - x);
+      }
+    }
+    else
+    {
+      if(x.crepresentation() == 0)
+      {
+        result = local_negatable_type(1U);
+      }
+      else if(x == negatable_constants<local_negatable_type>::pi_half())
+      {
+        result = local_negatable_type(0U);
+      }
+      else
+      {
+        // Use a polynomial approximation.
+        // cos(x) = approx. + 0.9999999998329485
+        //                  - 0.4999999947816307 x^2
+        //                  + 0.0416666405328244 x^4
+        //                  - 0.0013888413877237 x^6
+        //                  + 0.0000247627549571 x^8
+        //                  - 0.0000002609587957 x^10
+        // in the range -pi/2 <= x <= +pi/2. These coefficients
+        // have been specifically derived for this work.
+
+        const local_negatable_type x2 = (x * x);
+
+        // Perform the polynomial approximation using a coefficient
+        // expansion via the method of Horner.
+        result = (((((     - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000003) >> (24 + FractionalResolution)))    // 0.00000022171564942
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00000196) >> (24 + FractionalResolution))))   // 0.00002424851890444
+                      * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00005AD9) >> (24 + FractionalResolution))))   // 0.00138624146943166
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000AAA4a) >> (24 + FractionalResolution))))   // 0.04166094016112324
+                      * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x007FFFB4) >> (24 + FractionalResolution))))   // 0.49999549949242657
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFF6) >> (24 + FractionalResolution))));  // 0.99999943833186084
+      }
+    }
+
+    return result;
+  }
+
+  /*! Computes cosine function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::sin_cos_wide_helper<local_negatable_type>                      local_helper_type;
+
+    // Handle reflection for negative arguments.
+    if(x.crepresentation() < 0)
+    {
+      x = -x;
+    }
+
+    // Reduce the argument to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4.
+    local_negatable_type r;
+
+    // Use cos(x) = sin(x + pi/2) in order to select the kernel
+    // and the sign of the result from the quadrant.
+    const std::uint_fast8_t q = static_cast<std::uint_fast8_t>((detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r) + 1U) % 4U);
+
+    const local_negatable_type result = (((q % 2U) == 0U) ? local_helper_type::sin_kernel(r)
+                                                          : local_helper_type::cos_kernel(r));
+
+    return ((q >= 2U) ? -result : result);
+  }
+
+  /*! Computes sine and cosine together for fractional resolution <= 24 bits.
+      The reflection and the argument reduction are shared between sine and cosine.
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  void sincos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+              negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s,
+              negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c,
+              typename std::enable_if<24 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    // Handle reflection for negative arguments.
+    const bool x_is_neg = (x.crepresentation() < 0);
+
+    if(x_is_neg)
+    {
+      x = -x;
+    }
+
+    local_negatable_type sin_x;
+    local_negatable_type cos_x;
+
+    if(x > negatable_constants<local_negatable_type>::pi())
+    {
+      // Reduce the argument to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4.
+      local_negatable_type r;
+
+      const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+      // Here, sin(r) and cos(r) find their argument in the range -pi/4 <= r <= +pi/4,
+      // so that neither of them performs a reduction of its own.
+      const local_negatable_type sin_r = sin(r);
+      const local_negatable_type cos_r = cos(r);
+
+      // Reconstruct sin(x) and cos(x) from the quadrant q = (n mod 4).
+      const bool q_is_odd = ((q % 2U) != 0U);
+
+      sin_x = (q_is_odd ? cos_r : sin_r);
+      cos_x = (q_is_odd ? sin_r : cos_r);
+
+      if(q >= 2U)
+      {
+        sin_x = -sin_x;
+      }
+
+      if((q == 1U) || (q == 2U))
+      {
+        cos_x = -cos_x;
+      }
+    }
+    else
+    {
+      // Arguments up to pi need no reduction.
+      sin_x = sin(x);
+      cos_x = cos(x);
+    }
+
+    *s = ((!x_is_neg) ? sin_x : -sin_x);
+    *c = cos_x;
+  }
+
+  /*! Computes sine and cosine together for fractional resolution > 24 bits.
+      The reflection and the argument reduction are shared between sine and cosine.
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  void sincos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+              negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s,
+              negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c,
+              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::sin_cos_wide_helper<local_negatable_type>                      local_helper_type;
+
+    // Handle reflection for negative arguments.
+    const bool x_is_neg = (x.crepresentation() < 0);
+
+    if(x_is_neg)
+    {
+      x = -x;
+    }
+
+    // Reduce the argument to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4.
+    local_negatable_type r;
+
+    const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+    const local_negatable_type sin_r = local_helper_type::sin_kernel(r);
+    const local_negatable_type cos_r = local_helper_type::cos_kernel(r);
+
+    // Reconstruct sin(x) and cos(x) from the quadrant q = (n mod 4).
+    const bool q_is_odd = ((q % 2U) != 0U);
+
+    const local_negatable_type& sin_x = (q_is_odd ? cos_r : sin_r);
+    const local_negatable_type& cos_x = (q_is_odd ? sin_r : cos_r);
+
+    const bool sin_is_neg = ((q >= 2U) != x_is_neg);
+    const bool cos_is_neg = ((q == 1U) || (q == 2U));
+
+    *s = ((!sin_is_neg) ? sin_x : -sin_x);
+    *c = ((!cos_is_neg) ? cos_x : -cos_x);
+  }
+
+  /*! Computes tangent function for fractional resolution < 11 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    // Handle negative arguments, zero argument and argument pi/2.
+    if(x.crepresentation() < 0)
+    {
+      return -tan(-x);
+    }
+    else if(x.crepresentation() == 0)
+    {
+      return local_negatable_type(0U);
+    }
+    else if(x == negatable_constants<local_negatable_type>::pi_half())
+    {
+      return (std::numeric_limits<local_negatable_type>::max)();
+    }
+
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use tan(x) = tan(r) for even n and tan(x) = -1 / tan(r) for odd n.
+    if(x > negatable_constants<local_negatable_type>::pi())
+    {
+      local_negatable_type r;
+
+      const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+      const local_negatable_type tan_r = tan(r);
+
+      if((q % 2U) == 0U)
+      {
+        return tan_r;
+      }
+
+      return ((tan_r.crepresentation() == 0) ? (std::numeric_limits<local_negatable_type>::max)()
+                                             : -(local_negatable_type(1U) / tan_r));
+    }
+
+    local_negatable_type result;
+
+    if(x > negatable_constants<local_negatable_type>::pi_half())
+    {
+      result = -tan(negatable_constants<local_negatable_type>::pi() - x);
+    }
+    else
+    {
+      const local_negatable_type pi_over_four = negatable_constants<local_negatable_type>::pi_quarter();
+
+      if(x > pi_over_four)
+      {
+        const local_negatable_type tan_value_shifted = tan(x - pi_over_four);
+
+        result = (1 + tan_value_shifted) / (1 - tan_value_shifted);
+      }
+      else if(x < pi_over_four)
+      {
+        // Use a polynomial approximation.
+        // tan(x) / x = approx. + 0.999966509199007
+        //                      + 0.335162805277695 x^2
+        //                      + 0.118177026215436 x^4
+        //                      + 0.091380425311140 x^6,
+        // in the range 0 <= x <= +pi/4. These coefficients
+        // have been specifically derived for this work.
+
+        const local_negatable_type x2 = (x * x);
+
+        // Perform the polynomial approximation using a coefficient
+        // expansion via the method of Horner.
+        result = (((       local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x00BB) >> (11 + FractionalResolution)))   // 0.01987397353189
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x00F2) >> (11 + FractionalResolution))))  // 0.01326787053456
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x02AE) >> (11 + FractionalResolution))))  // 0.33335465351938
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.99999982053522
+                    * x;
+      }
+      else
+      {
+        // The argument is exactly +pi/4.
+        result = local_negatable_type(1U);
+      }
+    }
+
+    return result;
+  }
+
+  /*! Computes tangent function for fractional resolution < 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    // Handle negative arguments, zero argument and argument pi/2.
+    if(x.crepresentation() < 0)
+    {
+      return -tan(-x);
+    }
+    else if(x.crepresentation() == 0)
+    {
+      return local_negatable_type(0U);
+    }
+    else if(x == negatable_constants<local_negatable_type>::pi_half())
+    {
+      return (std::numeric_limits<local_negatable_type>::max)();
+    }
+
+    // Reduce arguments exceeding pi to x = r + (n * pi/2), with -pi/4 <= r <= +pi/4,
+    // and use tan(x) = tan(r) for even n and tan(x) = -1 / tan(r) for odd n.
+    if(x > negatable_constants<local_negatable_type>::pi())
+    {
+      local_negatable_type r;
+
+      const std::uint_fast8_t q = detail::argument_reduction_pi_half<local_negatable_type>::reduce(x, r);
+
+      const local_negatable_type tan_r = tan(r);
+
+      if((q % 2U) == 0U)
+      {
+        return tan_r;
+      }
+
+      return ((tan_r.crepresentation() == 0) ? (std::numeric_limits<local_negatable_type>::max)()
+                                             : -(local_negatable_type(1U) / tan_r));
+    }
+
+    local_negatable_type result;
+
+    if(x > negatable_constants<local_negatable_type>::pi_half())
+    {
+      result = -tan(negatable_constants<local_negatable_type>::pi() - x);
+    }
+    else
+    {
+      const local_negatable_type pi_over_four = negatable_constants<local_negatable_type>::pi_quarter();
+
+      if(x > pi_over_four)
+      {
+        const local_negatable_type tan_value_shifted = tan(x - pi_over_four);
+
+        result = (1 + tan_value_shifted) / (1 - tan_value_shifted);
+      }
+      else if(x < pi_over_four)
+      {
+        // Use a polynomial approximation.
+        // tan(x) / x = approx. + 0.99999982053522
+        //                      + 0.33335465351938 x^2
+        //                      + 0.13292151590120 x^4
+        //                      + 0.05681862499001 x^6
+        //                      + 0.01326787053456 x^8
+        //                      + 0.01987397353189 x^10,
+        // in the range 0 <= x <= +pi/4. These coefficients
+        // have been specifically derived for this work.
+
+        const local_negatable_type x2 = (x * x);
+
+        // Perform the polynomial approximation using a coefficient
+        // expansion via the method of Horner.
+        result = (((((       local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00051675) >> (24 + FractionalResolution)))   // 0.01987397353189
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00036585) >> (24 + FractionalResolution))))  // 0.01326787053456
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000E8BAA) >> (24 + FractionalResolution))))  // 0.05681862499001
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00220724) >> (24 + FractionalResolution))))  // 0.13292151590120
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x005556BB) >> (24 + FractionalResolution))))  // 0.33335465351938
+                      * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFFC) >> (24 + FractionalResolution))))  // 0.99999982053522
+                      * x;
+      }
+      else
+      {
+        // The argument is exactly +pi/4.
+        result = local_negatable_type(1U);
+      }
+    }
+
+    return result;
+  }
+
+  /*! Computes tangent function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    // Handle negative arguments, zero argument and argument pi/2.
+    if(x.crepresentation() < 0)
+    {
+      return -tan(-x);
+    }
+    else if(x.crepresentation() == 0)
+    {
+      return local_negatable_type(0U);
+    }
+    else if(x == negatable_constants<local_negatable_type>::pi_half())
+    {
+      return (std::numeric_limits<local_negatable_type>::max)();
+    }
+
+    // Compute tan(x) = [sin(x) / cos(x)], whereby sin(x) and cos(x)
+    // share a single argument reduction via sincos(negatable).
+    local_negatable_type sin_x;
+    local_negatable_type cos_x;
+
+    sincos(x, &sin_x, &cos_x);
+
+    return sin_x / cos_x;
+  }
+
+  /*! Computes arc sine function for fractional resolution < 11 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return -asin(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == 1)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      if(x < ldexp(local_negatable_type(1U), -2))
+      {
+        const local_negatable_type x2 = (x * x);
+
+        // Use the Taylor series representation for small argument.
+        // asin(x) = approx. x + (x^3)/6 + 3(x^5)/40 + 5(x^7)/112
+
+        result = (((     + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x005B) >> (11 + FractionalResolution)))
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0099) >> (11 + FractionalResolution))))
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0155) >> (11 + FractionalResolution))))
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))
+                    * x;
+      }
+      else
+      {
+        // Use a polynomial approximation.
+        // asin(x) = approx. pi/2 - [sqrt(1 - x) * (+ 1.5707288
+        //                                          - 0.2121144 x^1
+        //                                          + 0.0742610 x^2
+        //                                          - 0.0187293 x^3],
+        // in the range 0 <= x <= +1. These coefficients
+        // have been taken from Eq. 4.4.45 in Abramowitz & Stegun,
+        // "Handbook of Mathematical Functions", 0009-Revised edition
+        // (Dover Publications, 1965).
+        // The coefficients originate from C. Hastings, "Approximations
+        // for Digital Computers" (Princeton Univ. Press, 1955).
+
+        // Perform the polynomial approximation using a coefficient
+        // expansion via the method of Horner.
+        const local_negatable_type polynomial_approximation =
+          (((    - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0026) >> (11 + FractionalResolution)))   // 0.0187293
+             * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0098) >> (11 + FractionalResolution))))  // 0.0742610
+             * x - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x01B2) >> (11 + FractionalResolution))))  // 0.2121144
+             * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0C90) >> (11 + FractionalResolution)))); // 1.5707288
+
+        result = negatable_constants<local_negatable_type>::pi_half() - (sqrt(1 - x) * polynomial_approximation);
+      }
+    }
+
+    return result;
+  }
+
+  /*! Computes arc sine function for fractional resolution < 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return -asin(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == 1)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      // Use a polynomial approximation.
+      // asin(x) = approx. pi/2 - [sqrt(1 - x) * (+ 1.5707962797298
+      //                                          - 0.2145976333738 x^1
+      //                                          + 0.0889661326639 x^2
+      //                                          - 0.0501164255199 x^3
+      //                                          + 0.0307646026592 x^4
+      //                                          - 0.0169450735826 x^5
+      //                                          + 0.0065926664377 x^6
+      //                                          - 0.0012470498685 x^7)],
+      // in the range 0 <= x <= +1. These coefficients
+      // have been specifically derived for this work.
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      const local_negatable_type polynomial_approximation =
+        (((((((    - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000051BA) >> (24 + FractionalResolution)))   // 0.0012470498685
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0001B00E) >> (24 + FractionalResolution))))  // 0.0065926664377
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00045683) >> (24 + FractionalResolution))))  // 0.0169450735826
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0007E030) >> (24 + FractionalResolution))))  // 0.0307646026592
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000CD46E) >> (24 + FractionalResolution))))  // 0.0501164255199
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0016C67C) >> (24 + FractionalResolution))))  // 0.0889661326639
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0036EFDE) >> (24 + FractionalResolution))))  // 0.2145976333738
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01921FB4) >> (24 + FractionalResolution)))); // 1.5707962797298
+
+      result = negatable_constants<local_negatable_type>::pi_half() - (sqrt(1 - x) * polynomial_approximation);
+    }
+
+    return result;
+  }
+
+  namespace detail
+  {
+    template<typename NegatableType>
+    NegatableType acos_from_atan(const NegatableType& x);
+
+    // Compute asin(x) for 0 < x < 1 from atan on the negatable type.
+    template<typename NegatableType>
+    NegatableType asin_from_atan(const NegatableType& x)
+    {
+      if(x > ldexp(NegatableType(1U), -1))
+      {
+        return negatable_constants<NegatableType>::pi_half() - acos_from_atan(x);
+      }
+      else
+      {
+        // Use asin(x) = atan(x / sqrt(1 - x^2)), for which the argument
+        // of atan is less than or equal to 1/sqrt(3).
+        return atan(x / sqrt((1 - x) * (1 + x)));
+      }
+    }
+
+    // Compute acos(x) for 0 < x < 1 from atan on the negatable type.
+    template<typename NegatableType>
+    NegatableType acos_from_atan(const NegatableType& x)
+    {
+      if(x > ldexp(NegatableType(1U), -1))
+      {
+        // Use acos(x) = 2 atan(sqrt(1 - x) / sqrt(1 + x)). The difference 1 - x
+        // is exact and its correctly rounded square root retains the precision
+        // near x = 1, where the Newton iteration of sqrt loses relative precision.
+        return ldexp(atan(shift::sqrt(1 - x) / sqrt(1 + x)), 1);
+      }
+      else
+      {
+        return negatable_constants<NegatableType>::pi_half() - asin_from_atan(x);
+      }
+    }
+
+    template<typename NegatableType>
+    NegatableType asin_wide_kernel(const NegatableType& x, std::true_type)
+    {
+      return asin_from_atan(x);
+    }
+
+    template<typename NegatableType>
+    NegatableType asin_wide_series(const NegatableType& x, std::false_type)
+    {
+      return asin_from_atan(x);
+    }
+
+    template<typename NegatableType>
+    NegatableType asin_wide_kernel(const NegatableType& x, std::false_type)
+    {
+      typedef typename wide_atan_tier<NegatableType::radix_split>::use_argument_halving use_argument_halving;
+
+      return asin_wide_series(x, use_argument_halving());
+    }
+
+    template<typename NegatableType>
+    NegatableType acos_wide_kernel(const NegatableType& x, std::true_type)
+    {
+      return acos_from_atan(x);
+    }
+
+    template<typename NegatableType>
+    NegatableType acos_wide_series(const NegatableType& x, std::false_type)
+    {
+      return acos_from_atan(x);
+    }
+
+    template<typename NegatableType>
+    NegatableType acos_wide_kernel(const NegatableType& x, std::false_type)
+    {
+      typedef typename wide_atan_tier<NegatableType::radix_split>::use_argument_halving use_argument_halving;
+
+      return acos_wide_series(x, use_argument_halving());
+    }
+  } // namespace detail
+
+  /*! Computes arc sine function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(x.crepresentation() < 0)
+    {
+      return -asin(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == 1)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      result = detail::asin_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+    }
+
+    return result;
+  }
+
+  /*! Computes arc cosine function for fractional resolution < 11 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return negatable_constants<local_negatable_type>::pi() - acos(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x == 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      // Use a polynomial approximation.
+      // acos(x) = approx. sqrt(1 - x) * (+ 1.5707962797298
+      //                                  - 0.2145976333738 x^1
+      //                                  + 0.0889661326639 x^2
+      //                                  - 0.0501164255199 x^3)],
+      // in the range 0 <= x <= +1. These coefficients
+      // have been taken from Eq. 4.4.45 in Abramowitz & Stegun,
+      // "Handbook of Mathematical Functions", 0009-Revised edition
+      // (Dover Publications, 1965).
+      // The coefficients originate from C. Hastings, "Approximations
+      // for Digital Computers" (Princeton Univ. Press, 1955).
+
+      // These are the same coefficients that are used
+      // for asin(x) above.
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      const local_negatable_type polynomial_approximation =
+        (((    - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0026) >> (11 + FractionalResolution)))   // 0.0187293
+           * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0098) >> (11 + FractionalResolution))))  // 0.0742610
+           * x - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x01B2) >> (11 + FractionalResolution))))  // 0.2121144
+           * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0C90) >> (11 + FractionalResolution)))); // 1.5707288
+
+      result = (sqrt(1 - x) * polynomial_approximation);
+    }
+
+    return result;
+  }
+
+  /*! Computes arc cosine function for fractional resolution < 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return negatable_constants<local_negatable_type>::pi() - acos(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x == 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      // Use a polynomial approximation.
+      // acos(x) = approx. [sqrt(1 - x) * (+ 1.5707962797298
+      //                                   - 0.2145976333738 x^1
+      //                                   + 0.0889661326639 x^2
+      //                                   - 0.0501164255199 x^3
+      //                                   + 0.0307646026592 x^4
+      //                                   - 0.0169450735826 x^5
+      //                                   + 0.0065926664377 x^6
+      //                                   - 0.0012470498685 x^7)],
+      // in the range 0 <= x <= +1. These coefficients
+      // have been specifically derived for this work.
+      // These are the same coefficients that are used
+      // for asin(x) above.
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      const local_negatable_type polynomial_approximation =
+        (((((((    - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000051BA) >> (24 + FractionalResolution)))   // 0.0012470498685
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0001B00E) >> (24 + FractionalResolution))))  // 0.0065926664377
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00045683) >> (24 + FractionalResolution))))  // 0.0169450735826
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0007E030) >> (24 + FractionalResolution))))  // 0.0307646026592
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000CD46E) >> (24 + FractionalResolution))))  // 0.0501164255199
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0016C67C) >> (24 + FractionalResolution))))  // 0.0889661326639
+               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0036EFDE) >> (24 + FractionalResolution))))  // 0.2145976333738
+               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01921FB4) >> (24 + FractionalResolution)))); // 1.5707962797298
+
+      result = (sqrt(1 - x) * polynomial_approximation);
+    }
+
+    return result;
+  }
+
+  /*! Computes arc cosine function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(x.crepresentation() < 0)
+    {
+      return negatable_constants<local_negatable_type>::pi() - acos(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = negatable_constants<local_negatable_type>::pi_half();
+    }
+    else if(x == 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x > 1)
+    {
+      result = local_negatable_type(0U);
+    }
+    else
+    {
+      result = detail::acos_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+    }
+
+    return result;
+  }
+
+  /*! Computes arc or inverse tangent function atan.
+  \sa http://en.cppreference.com/w/cpp/numeric/math/atan
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return -atan(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == local_negatable_type(1U))
+    {
+      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
+    }
+    else if(x > local_negatable_type(1U))
+    {
+      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+    }
+    else
+    {
+      // Use a polynomial approximation.
+      // atan(x) / x = approx. + 0.9998329769337240
+      //                       - 0.3268824051434949 x^2
+      //                       + 0.1590294514698240 x^4
+      //                       - 0.0469818803609288 x^6,
+      // in the range 0 <= x <= 1. These coefficients
+      // have been specifically derived for this work.
+      const local_negatable_type x2 = (x * x);
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      result = (((     - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0060) >> (11 + FractionalResolution)))   // 0.014236215058440372
+                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0145) >> (11 + FractionalResolution))))  // 0.059227914090755230
+                  * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x029D) >> (11 + FractionalResolution))))  // 0.122639496662731095
+                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.999996396967490826
+                  * x;
+    }
+
+    return result;
+  }
+
+  /*! Computes arc tangent function for fractional resolution < 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() < 0)
+    {
+      return -atan(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == local_negatable_type(1U))
+    {
+      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
+    }
+    else if(x > local_negatable_type(1U))
+    {
+      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+    }
+    else
+    {
+      // Use a polynomial approximation.
+      // atan(x) / x = approx. + 0.999996396967490826
+      //                       - 0.333043397362190827 x^2
+      //                       + 0.196084683947839669 x^4
+      //                       - 0.122639496662731095 x^6
+      //                       + 0.059227914090755230 x^8
+      //                       - 0.014236215058440372 x^10,
+      // in the range 0 <= x <= 1. These coefficients
+      // have been specifically derived for this work.
+      const local_negatable_type x2 = (x * x);
+
+      // Perform the polynomial approximation using a coefficient
+      // expansion via the method of Horner.
+      result = (((((     - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0003A4FC) >> (24 + FractionalResolution)))   // 0.014236215058440372
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000F298F) >> (24 + FractionalResolution))))  // 0.059227914090755230
+                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x001F654D) >> (24 + FractionalResolution))))  // 0.122639496662731095
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0032329B) >> (24 + FractionalResolution))))  // 0.196084683947839669
+                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00554255) >> (24 + FractionalResolution))))  // 0.333043397362190827
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFC3) >> (24 + FractionalResolution))))  // 0.999996396967490826
+                    * x;
+    }
+
+    return result;
+  }
+
+  namespace detail
+  {
+    // Compute atan(x) for 0 < x < 1.
+    template<typename NegatableType>
+    NegatableType atan_wide_kernel(const NegatableType& x, std::true_type)
+    {
+      typedef minimax_atan<minimax_helper<NegatableType>::tier> table_type;
+
+      // For x > tan(pi/8) = sqrt(2) - 1, use atan(x) = pi/4 + atan(u),
+      // with u = (x - 1) / (x + 1), for which |u| <= tan(pi/8).
+      if(x > (negatable_constants<NegatableType>::root_two() - 1U))
+      {
+        const NegatableType u = (x - 1U) / (x + 1U);
+
+        return   ldexp(negatable_constants<NegatableType>::pi(), -2)
+               + (minimax_helper<NegatableType>::template polynomial<table_type>(u * u) * u);
+      }
+      else
+      {
+        return minimax_helper<NegatableType>::template polynomial<table_type>(x * x) * x;
+      }
+    }
+
+    template<typename NegatableType>
+    NegatableType atan_wide_series(const NegatableType& x, std::false_type)
+    {
+      NegatableType result;
+
+      if(x < ldexp(NegatableType(1U), -3))
+      {
+        const NegatableType one_half     = ldexp(NegatableType(1U), -1);
+        const NegatableType three_halves = ldexp(NegatableType(3U), -1);
+
+        // Use a hypergeometric series expansion for small argument.
+        result = x * hypergeometric_2f1( NegatableType(1U),
+                                         one_half,
+                                         three_halves,
+                                        -(x * x));
+      }
+      else
+      {
+        // Use Newton-Raphson iteration for atan.
+
+        // Obtain an initial guess using a two-term Pade approximation
+        // for atan(x). The coefficients for this Pade approximation
+        // have been specifically derived for this work.
+        result = (x * 3U) / (3U + (x * x));
+
+        // Do the Newton-Raphson iteration. Start with four binary digits
+        // of precision obtained from the initial guess above.
+        for(std::uint_fast16_t i = UINT16_C(4); i <= std::uint_fast16_t(NegatableType::all_bits / 2); i *= UINT16_C(2))
+        {
+          const NegatableType c = cos(result);
+          const NegatableType s = sin(result);
+
+          result += (c * ((x * c) - s));
+        }
+      }
+
+      return result;
+    }
+
+    template<typename NegatableType>
+    NegatableType atan_wide_kernel(const NegatableType& x, std::false_type)
+    {
+      typedef typename wide_atan_tier<NegatableType::radix_split>::use_argument_halving use_argument_halving;
+
+      return atan_wide_series(x, use_argument_halving());
+    }
+  } // namespace detail
+
+  /*! Computes arc tangent function for fractional resolution > 24 bits. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(x.crepresentation() < 0)
+    {
+      return -atan(-x);
+    }
+
+    local_negatable_type result;
+
+    if(x.crepresentation() == 0)
+    {
+      result = local_negatable_type(0U);
+    }
+    else if(x == local_negatable_type(1U))
+    {
+      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
+    }
+    else if(x > local_negatable_type(1U))
+    {
+      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+    }
+    else
+    {
+      result = detail::atan_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
+    }
+
+    return result;
+  }
+
+  /*! Computes the arc tangent of y/x using the signs of arguments to determine the correct quadrant for any fractional resolution. 
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    // Handle the negative arguments and zero arguments.
+    const bool x_is_neg = (x.crepresentation() < 0);
+
+    if(y == 0)
+    {
+      return ((!x_is_neg) ? local_negatable_type(0U) : negatable_constants<local_negatable_type>::pi());
+    }
+
+    const bool y_is_neg = (y < 0);
+
+    if(x.crepresentation() == 0)
+    {
+      return ((!y_is_neg) ? negatable_constants<local_negatable_type>::pi_half() : -negatable_constants<local_negatable_type>::pi_half());
+    }
+
+    // Compute atan(y / x), thereby ignoring the sign of the arguments.
+    const local_negatable_type atan_term(atan(y / x));
+
+    // Determine the proper quadrant based on signs of x and y.
+    return ((y_is_neg == x_is_neg) ? ((!x_is_neg) ? atan_term : (atan_term - negatable_constants<local_negatable_type>::pi()))
+                                   : ((!x_is_neg) ? atan_term : (atan_term + negatable_constants<local_negatable_type>::pi())));
+  }
+
+  namespace detail
+  {
+    // Compute sinh(x) and cosh(x) for x >= 0 from e = expm1(x) and the single
+    // reciprocal q = 1 / (e + 1) = exp(-x), with sinh(x) = (e + (e * q)) / 2
+    // and cosh(x) = sinh(x) + q. The product e * q retains the relative
+    // precision of e, also for x close to 0. No intermediate result exceeds e + 1.
+    template<typename NegatableType>
+    void sinh_cosh_kernel(const NegatableType& x, NegatableType* s, NegatableType* c)
+    {
+      const NegatableType e = expm1(x);
+      const NegatableType q = 1U / (e + 1U);
+
+      const NegatableType sinh_x = (e + (e * q)) / std::integral_constant<unsigned, 2U>();
+
+      if(s != nullptr)
+      {
+        *s = sinh_x;
+      }
+
+      if(c != nullptr)
+      {
+        *c = sinh_x + q;
+      }
+    }
+  } // namespace detail
+
+  /*! Compute hyperbolic sine sinh. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    if(x.crepresentation() < 0)
+    {
+      // Handle negative argument.
+      return -sinh(-x);
+    }
+
+    local_negatable_type result;
+
+    detail::sinh_cosh_kernel(x, &result, static_cast<local_negatable_type*>(nullptr));
+
+    return result;
+  }
+
+  /*! Compute hyperbolic cosine cosh. */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+
+    local_negatable_type result;
+
+    detail::sinh_cosh_kernel(((x.crepresentation() < 0) ? -x : x), static_cast<local_negatable_type*>(nullptr), &result);
+
     return result;
   }
 
-  /*! Computes tangent function for fractional resolution > 24 bits. */
+  /*! Computes hyperbolic sine and hyperbolic cosine together.
+      Both of them share a single call of expm1 and a single division.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                              typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  void sinh_cosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                 negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* s,
+                 negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>* c)
   {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    // Handle reflection for negative arguments.
+    const bool x_is_neg = (x.crepresentation() < 0);
 
-    // Handle negative arguments, zero argument and argument pi/2.
-    if(x.crepresentation() < 0)
-    {
-      return -tan(-x);
-    }
-    else if(x.crepresentation() == 0)
-    {
-      return local_negatable_type(0U);
-    }
-    else if(x == negatable_constants<local_negatable_type>::pi_half())
+    detail::sinh_cosh_kernel(((!x_is_neg) ? x : -x), s, c);
+
+    if(x_is_neg)
     {
-      return (std::numeric_limits<local_negatable_type>::max)();
+      *s = -*s;
     }
-
-    // Use a relatively lazy calculation for tan(x) here.
-    // Since there is no support for the potentially supported
-    // function sincos(negatable), we simply use the result
-    // of the division tan(x) = [sin(x) / cos(x)] for tangent.
-    // Here, sin(x) and cos(x) are computed separately.
-
-    return sin(x) / cos(x);
   }
 
-  /*! Computes arc sine function for fractional resolution < 11 bits. */
+  /*! Compute hyperbolic tangent tanh. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
     if(x.crepresentation() < 0)
     {
-      return -asin(-x);
+      // Handle negative argument.
+      return -tanh(-x);
     }
 
-    local_negatable_type result;
-
     if(x.crepresentation() == 0)
     {
-      result = local_negatable_type(0U);
-    }
-    else if(x == 1)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
+      return local_negatable_type(0U);
     }
-    else if(x > 1)
+
+    // Use tanh(x) = -E / (E + 2), with E = expm1(-2x) and -1 < E < 0,
+    // so that exp(2x) can not overflow. If 2x itself would overflow,
+    // use E = e * (e + 2), with e = expm1(-x).
+    local_negatable_type e_twice;
+
+    if(x < ldexp((std::numeric_limits<local_negatable_type>::max)(), -1))
     {
-      result = local_negatable_type(0U);
+      e_twice = expm1(-ldexp(x, 1));
     }
     else
     {
-      if(x < ldexp(local_negatable_type(1U), -2))
-      {
-        const local_negatable_type x2 = (x * x);
-
-        // Use the Taylor series representation for small argument.
-        // asin(x) = approx. x + (x^3)/6 + 3(x^5)/40 + 5(x^7)/112
-
-        result = (((     + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x005B) >> (11 + FractionalResolution)))
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0099) >> (11 + FractionalResolution))))
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0155) >> (11 + FractionalResolution))))
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))
-                    * x;
-      }
-      else
-      {
-        // Use a polynomial approximation.
-        // asin(x) = approx. pi/2 - [sqrt(1 - x) * (+ 1.5707288
-        //                                          - 0.2121144 x^1
-        //                                          + 0.0742610 x^2
-        //                                          - 0.0187293 x^3],
-        // in the range 0 <= x <= +1. These coefficients
-        // have been taken from Eq. 4.4.45 in Abramowitz & Stegun,
-        // "Handbook of Mathematical Functions", 0009-Revised edition
-        // (Dover Publications, 1965).
-        // The coefficients originate from C. Hastings, "Approximations
-        // for Digital Computers" (Princeton Univ. Press, 1955).
-
-        // Perform the polynomial approximation using a coefficient
-        // expansion via the method of Horner.
-        const local_negatable_type polynomial_approximation =
-          (((    - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0026) >> (11 + FractionalResolution)))   // 0.0187293
-             * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0098) >> (11 + FractionalResolution))))  // 0.0742610
-             * x - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x01B2) >> (11 + FractionalResolution))))  // 0.2121144
-             * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0C90) >> (11 + FractionalResolution)))); // 1.5707288
+      const local_negatable_type e = expm1(-x);
 
-        result = negatable_constants<local_negatable_type>::pi_half() - (sqrt(1 - x) * polynomial_approximation);
-      }
+      e_twice = e * (e + 2U);
     }
 
-    return result;
+    return -e_twice / (e_twice + 2U);
   }
 
-  /*! Computes arc sine function for fractional resolution < 24 bits. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  namespace detail
   {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
-
-    if(x.crepresentation() < 0)
+    // Compute asinh(x) for x >= 1/2, or acosh(x) for x >= 3/2, from
+    // log(x + sqrt(x^2 +- 1)) = n log(2) + log(m + sqrt(m^2 +- 4^-n)),
+    // with x = m * 2^n and 1/2 <= m < 1. The scaling avoids the overflow of x^2
+    // and leaves an argument of log less than 1 + sqrt(2).
+    template<typename NegatableType>
+    NegatableType asinh_acosh_scaled_log(const NegatableType& x, const bool is_acosh)
     {
-      return -asin(-x);
-    }
+      int n;
 
-    local_negatable_type result;
+      const NegatableType m  = frexp(x, &n);
+      const NegatableType m2 = m * m;
+      const NegatableType c  = (((2 * n) <= NegatableType::radix_split) ? ldexp(NegatableType(1U), -2 * n) : NegatableType(0U));
 
-    if(x.crepresentation() == 0)
-    {
-      result = local_negatable_type(0U);
-    }
-    else if(x == 1)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
-    }
-    else if(x > 1)
-    {
-      result = local_negatable_type(0U);
+      return log(m + sqrt((!is_acosh) ? (m2 + c) : (m2 - c))) + (negatable_constants<NegatableType>::ln_two() * n);
     }
-    else
+
+    // Compute atanh(x) for 0 < x < 1 from atanh(x) = (log((1 + x) / m) - n log(2)) / 2,
+    // with 1 - x = m * 2^n and 1/2 <= m < 1. The argument of log is less than 4,
+    // also for x close to 1, where the quotient (1 + x) / (1 - x) would overflow.
+    template<typename NegatableType>
+    NegatableType atanh_scaled_log(const NegatableType& x)
     {
-      // Use a polynomial approximation.
-      // asin(x) = approx. pi/2 - [sqrt(1 - x) * (+ 1.5707962797298
-      //                                          - 0.2145976333738 x^1
-      //                                          + 0.0889661326639 x^2
-      //                                          - 0.0501164255199 x^3
-      //                                          + 0.0307646026592 x^4
-      //                                          - 0.0169450735826 x^5
-      //                                          + 0.0065926664377 x^6
-      //                                          - 0.0012470498685 x^7)],
-      // in the range 0 <= x <= +1. These coefficients
-      // have been specifically derived for this work.
+      int n;
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      const local_negatable_type polynomial_approximation =
-        (((((((    - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000051BA) >> (24 + FractionalResolution)))   // 0.0012470498685
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0001B00E) >> (24 + FractionalResolution))))  // 0.0065926664377
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00045683) >> (24 + FractionalResolution))))  // 0.0169450735826
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0007E030) >> (24 + FractionalResolution))))  // 0.0307646026592
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000CD46E) >> (24 + FractionalResolution))))  // 0.0501164255199
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0016C67C) >> (24 + FractionalResolution))))  // 0.0889661326639
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0036EFDE) >> (24 + FractionalResolution))))  // 0.2145976333738
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01921FB4) >> (24 + FractionalResolution)))); // 1.5707962797298
+      const NegatableType m = frexp(1 - x, &n);
 
-      result = negatable_constants<local_negatable_type>::pi_half() - (sqrt(1 - x) * polynomial_approximation);
+      return (log((1 + x) / m) - (negatable_constants<NegatableType>::ln_two() * n)) / std::integral_constant<unsigned, 2U>();
     }
+  } // namespace detail
 
-    return result;
-  }
-
-  /*! Computes arc sine function for fractional resolution > 24 bits. */
+  /*! Compute inverse hyperbolic sine asinh for fractional resolution <= 11 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
 
     if(x.crepresentation() < 0)
     {
-      return -asin(-x);
+      // Handle negative argument.
+      return -asinh(-x);
     }
 
     local_negatable_type result;
@@ -1782,40 +3440,33 @@
     {
       result = local_negatable_type(0U);
     }
-    else if(x == 1)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
-    }
-    else if(x > 1)
+    else if(x <= ldexp(local_negatable_type(1U), -1))
     {
-      result = local_negatable_type(0U);
+      // Use a polynomial approximation.
+      // asinh(x) = approx. x * (+ 0.9999840459
+      //                         - 0.1654560933 x^2
+      //                         + 0.0611133050 x^4),
+      // in the range 0 <= x <= +1/2. These coefficients
+      // have been specifically derived for this work.
+      const local_negatable_type x2 = (x * x);
+
+      result = ((     + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x007D) >> (11 + FractionalResolution)))   // 0.0611133050
+                 * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0153) >> (11 + FractionalResolution))))  // 0.1654560933
+                 * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.9999840459
+                 * x;
     }
     else
     {
-      const local_negatable_type one_half     = ldexp(local_negatable_type(1U), -1);
-      const local_negatable_type three_halves = ldexp(local_negatable_type(3U), -1);
-
-      if(x < one_half)
-      {
-        result = x * detail::hypergeometric_2f1(one_half, one_half, three_halves, (x * x));
-      }
-      else
-      {
-        const local_negatable_type delta = (1 - x);
-
-        result =   negatable_constants<local_negatable_type>::pi_half()
-                 - (  sqrt(delta * 2)
-                    * detail::hypergeometric_2f1(one_half, one_half, three_halves, delta / 2));
-      }
+      result = detail::asinh_acosh_scaled_log(x, false);
     }
 
     return result;
   }
 
-  /*! Computes arc cosine function for fractional resolution < 11 bits. */
+  /*! Compute inverse hyperbolic sine asinh for fractional resolution <= 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
@@ -1823,156 +3474,115 @@
 
     if(x.crepresentation() < 0)
     {
-      return negatable_constants<local_negatable_type>::pi() - acos(-x);
+      // Handle negative argument.
+      return -asinh(-x);
     }
 
     local_negatable_type result;
 
     if(x.crepresentation() == 0)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
-    }
-    else if(x == 1)
     {
       result = local_negatable_type(0U);
     }
-    else if(x > 1)
+    else if(x <= ldexp(local_negatable_type(1U), -1))
     {
-      result = local_negatable_type(0U);
+      // Use a polynomial approximation.
+      // asinh(x) = approx. x * (+ 0.9999999989152719
+      //                         - 0.1666663443636210 x^2
+      //                         + 0.0749844381345416 x^4
+      //                         - 0.0443653385624873 x^6
+      //                         + 0.0280921809656277 x^8
+      //                         - 0.0131254683185524 x^10),
+      // in the range 0 <= x <= +1/2. These coefficients
+      // have been specifically derived for this work.
+      const local_negatable_type x2 = (x * x);
+
+      result = (((((     - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00035C31) >> (24 + FractionalResolution)))   // 0.0131254683185524
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0007310D) >> (24 + FractionalResolution))))  // 0.0280921809656277
+                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000B5B87) >> (24 + FractionalResolution))))  // 0.0443653385624873
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0013322E) >> (24 + FractionalResolution))))  // 0.0749844381345416
+                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002AAAA5) >> (24 + FractionalResolution))))  // 0.1666663443636210
+                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 0.9999999989152719
+                    * x;
     }
     else
     {
-      // Use a polynomial approximation.
-      // acos(x) = approx. sqrt(1 - x) * (+ 1.5707962797298
-      //                                  - 0.2145976333738 x^1
-      //                                  + 0.0889661326639 x^2
-      //                                  - 0.0501164255199 x^3)],
-      // in the range 0 <= x <= +1. These coefficients
-      // have been taken from Eq. 4.4.45 in Abramowitz & Stegun,
-      // "Handbook of Mathematical Functions", 0009-Revised edition
-      // (Dover Publications, 1965).
-      // The coefficients originate from C. Hastings, "Approximations
-      // for Digital Computers" (Princeton Univ. Press, 1955).
-
-      // These are the same coefficients that are used
-      // for asin(x) above.
-
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      const local_negatable_type polynomial_approximation =
-        (((    - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0026) >> (11 + FractionalResolution)))   // 0.0187293
-           * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0098) >> (11 + FractionalResolution))))  // 0.0742610
-           * x - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x01B2) >> (11 + FractionalResolution))))  // 0.2121144
-           * x + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0C90) >> (11 + FractionalResolution)))); // 1.5707288
-
-      result = (sqrt(1 - x) * polynomial_approximation);
+      result = detail::asinh_acosh_scaled_log(x, false);
     }
 
     return result;
   }
 
-  /*! Computes arc cosine function for fractional resolution < 24 bits. */
+  /*! Compute inverse hyperbolic sine asinh for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
-    typedef typename local_negatable_type::value_type                               local_value_type;
-    typedef typename local_negatable_type::nothing                                  local_nothing;
 
     if(x.crepresentation() < 0)
     {
-      return negatable_constants<local_negatable_type>::pi() - acos(-x);
+      // Handle negative argument.
+      return -asinh(-x);
     }
 
     local_negatable_type result;
 
     if(x.crepresentation() == 0)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
-    }
-    else if(x == 1)
     {
       result = local_negatable_type(0U);
     }
-    else if(x > 1)
+    else if(x <= ldexp(local_negatable_type(1U), -1))
     {
-      result = local_negatable_type(0U);
+      // Use asinh(x) = log(1 + u) = 2 atanh(x / (1 + sqrt(1 + x^2))), with u = x + x^2 / (1 + sqrt(1 + x^2)).
+      // The argument of atanh is less than 1/4.
+      result = atanh(x / (1 + sqrt(1 + (x * x)))) * std::integral_constant<unsigned, 2U>();
     }
     else
     {
-      // Use a polynomial approximation.
-      // acos(x) = approx. [sqrt(1 - x) * (+ 1.5707962797298
-      //                                   - 0.2145976333738 x^1
-      //                                   + 0.0889661326639 x^2
-      //                                   - 0.0501164255199 x^3
-      //                                   + 0.0307646026592 x^4
-      //                                   - 0.0169450735826 x^5
-      //                                   + 0.0065926664377 x^6
-      //                                   - 0.0012470498685 x^7)],
-      // in the range 0 <= x <= +1. These coefficients
-      // have been specifically derived for this work.
-      // These are the same coefficients that are used
-      // for asin(x) above.
-
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      const local_negatable_type polynomial_approximation =
-        (((((((    - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000051BA) >> (24 + FractionalResolution)))   // 0.0012470498685
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0001B00E) >> (24 + FractionalResolution))))  // 0.0065926664377
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00045683) >> (24 + FractionalResolution))))  // 0.0169450735826
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0007E030) >> (24 + FractionalResolution))))  // 0.0307646026592
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000CD46E) >> (24 + FractionalResolution))))  // 0.0501164255199
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0016C67C) >> (24 + FractionalResolution))))  // 0.0889661326639
-               * x - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0036EFDE) >> (24 + FractionalResolution))))  // 0.2145976333738
-               * x + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01921FB4) >> (24 + FractionalResolution)))); // 1.5707962797298
-
-      result = (sqrt(1 - x) * polynomial_approximation);
+      result = detail::asinh_acosh_scaled_log(x, false);
     }
 
     return result;
   }
 
-  /*! Computes arc cosine function for fractional resolution > 24 bits. */
+  /*! Compute inverse hyperbolic cosine acosh. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
-    if(x.crepresentation() < 0)
-    {
-      return negatable_constants<local_negatable_type>::pi() - acos(-x);
-    }
-
     local_negatable_type result;
 
-    if(x.crepresentation() == 0)
-    {
-      result = negatable_constants<local_negatable_type>::pi_half();
-    }
-    else if(x == 1)
-    {
-      result = local_negatable_type(0U);
-    }
-    else if(x > 1)
+    if(x <= 1)
     {
+      // Handle arguments less than or equal to 1.
       result = local_negatable_type(0U);
     }
     else
     {
-      result = negatable_constants<local_negatable_type>::pi_half() - asin(x);
+      const local_negatable_type x_minus_one = x - 1;
+
+      if(x_minus_one <= ldexp(local_negatable_type(1U), -1))
+      {
+        // Use acosh(x) = 2 asinh(sqrt((x - 1) / 2)), for which the argument of asinh
+        // is less than or equal to 1/2. The correctly rounded square root of the
+        // exact 2 (x - 1) retains the precision near x = 1.
+        result = asinh(ldexp(shift::sqrt(x_minus_one * std::integral_constant<unsigned, 2U>()), -1)) * std::integral_constant<unsigned, 2U>();
+      }
+      else
+      {
+        result = detail::asinh_acosh_scaled_log(x, true);
+      }
     }
 
     return result;
   }
 
-  /*! Computes arc or inverse tangent function atan.
-  \sa http://en.cppreference.com/w/cpp/numeric/math/atan
-  */
+  /*! Compute inverse hyperbolic tangent atanh for fractional resolution <= 11 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<11 >= (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
@@ -1980,50 +3590,51 @@
 
     if(x.crepresentation() < 0)
     {
-      return -atan(-x);
+      // Handle negative argument.
+      return -atanh(-x);
     }
 
     local_negatable_type result;
 
     if(x.crepresentation() == 0)
     {
+      // Handle arguments identically equal to 0.
       result = local_negatable_type(0U);
     }
-    else if(x == local_negatable_type(1U))
-    {
-      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
-    }
-    else if(x > local_negatable_type(1U))
+    else if(x >= 1)
     {
-      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+      // Handle arguments greater than or equal to 1.
+      result = (std::numeric_limits<local_negatable_type>::max)();
     }
-    else
+    else if(x <= ldexp(local_negatable_type(1U), -1))
     {
       // Use a polynomial approximation.
-      // atan(x) / x = approx. + 0.9998329769337240
-      //                       - 0.3268824051434949 x^2
-      //                       + 0.1590294514698240 x^4
-      //                       - 0.0469818803609288 x^6,
-      // in the range 0 <= x <= 1. These coefficients
+      // atanh(x) = approx. x * (+ 0.9999940011
+      //                         + 0.3340594027 x^2
+      //                         + 0.1864128987 x^4
+      //                         + 0.2205844374 x^6),
+      // in the range 0 <= x <= +1/2. These coefficients
       // have been specifically derived for this work.
       const local_negatable_type x2 = (x * x);
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      result = (((     - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0060) >> (11 + FractionalResolution)))   // 0.014236215058440372
-                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0145) >> (11 + FractionalResolution))))  // 0.059227914090755230
-                  * x2 - local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x029D) >> (11 + FractionalResolution))))  // 0.122639496662731095
-                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x07FF) >> (11 + FractionalResolution))))  // 0.999996396967490826
+      result = (((     + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x01C4) >> (11 + FractionalResolution)))   // 0.2205844374
+                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x017E) >> (11 + FractionalResolution))))  // 0.1864128987
+                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x02AC) >> (11 + FractionalResolution))))  // 0.3340594027
+                  * x2 + local_negatable_type(local_nothing(), local_value_type(UINT16_C(0x0800) >> (11 + FractionalResolution))))  // 0.9999940011
                   * x;
     }
+    else
+    {
+      result = detail::atanh_scaled_log(x);
+    }
 
     return result;
   }
 
-  /*! Computes arc tangent function for fractional resolution < 24 bits. */
+  /*! Compute inverse hyperbolic tangent atanh for fractional resolution <= 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<(24 >= (-FractionalResolution)) && (11 < (-FractionalResolution))>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
     typedef typename local_negatable_type::value_type                               local_value_type;
@@ -2031,307 +3642,348 @@
 
     if(x.crepresentation() < 0)
     {
-      return -atan(-x);
+      // Handle negative argument.
+      return -atanh(-x);
     }
 
     local_negatable_type result;
 
     if(x.crepresentation() == 0)
     {
+      // Handle arguments identically equal to 0.
       result = local_negatable_type(0U);
     }
-    else if(x == local_negatable_type(1U))
-    {
-      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
-    }
-    else if(x > local_negatable_type(1U))
+    else if(x >= 1)
     {
-      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+      // Handle arguments greater than or equal to 1.
+      result = (std::numeric_limits<local_negatable_type>::max)();
     }
-    else
+    else if(x <= ldexp(local_negatable_type(1U), -1))
     {
       // Use a polynomial approximation.
-      // atan(x) / x = approx. + 0.999996396967490826
-      //                       - 0.333043397362190827 x^2
-      //                       + 0.196084683947839669 x^4
-      //                       - 0.122639496662731095 x^6
-      //                       + 0.059227914090755230 x^8
-      //                       - 0.014236215058440372 x^10,
-      // in the range 0 <= x <= 1. These coefficients
+      // atanh(x) = approx. x * (+ 1.0000000013270121
+      //                         + 0.3333328306619263 x^2
+      //                         + 0.2000310268535076 x^4
+      //                         + 0.1421436495717839 x^6
+      //                         + 0.1188162069122884 x^8
+      //                         + 0.0494578163767752 x^10
+      //                         + 0.1790778926860594 x^12),
+      // in the range 0 <= x <= +1/2. These coefficients
       // have been specifically derived for this work.
       const local_negatable_type x2 = (x * x);
 
-      // Perform the polynomial approximation using a coefficient
-      // expansion via the method of Horner.
-      result = (((((     - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0003A4FC) >> (24 + FractionalResolution)))   // 0.014236215058440372
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000F298F) >> (24 + FractionalResolution))))  // 0.059227914090755230
-                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x001F654D) >> (24 + FractionalResolution))))  // 0.122639496662731095
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0032329B) >> (24 + FractionalResolution))))  // 0.196084683947839669
-                    * x2 - local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00554255) >> (24 + FractionalResolution))))  // 0.333043397362190827
-                    * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00FFFFC3) >> (24 + FractionalResolution))))  // 0.999996396967490826
-                    * x;
+      result = ((((((     + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x002DD80C) >> (24 + FractionalResolution)))   // 0.1790778926860594
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x000CA944) >> (24 + FractionalResolution))))  // 0.0494578163767752
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x001E6ABD) >> (24 + FractionalResolution))))  // 0.1188162069122884
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x00246387) >> (24 + FractionalResolution))))  // 0.1421436495717839
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0033353C) >> (24 + FractionalResolution))))  // 0.2000310268535076
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x0055554D) >> (24 + FractionalResolution))))  // 0.3333328306619263
+                     * x2 + local_negatable_type(local_nothing(), local_value_type(UINT32_C(0x01000000) >> (24 + FractionalResolution))))  // 1.0000000013270121
+                     * x;
+    }
+    else
+    {
+      result = detail::atanh_scaled_log(x);
     }
 
     return result;
   }
 
-  /*! Computes arc tangent function for fractional resolution > 24 bits. */
+  namespace detail
+  {
+    // Compute atanh(x) for 0 < x <= 3 - 2 sqrt(2) with the minimax
+    // polynomial of the kernel of log, which is log(x) = 2 atanh(s).
+    template<typename NegatableType>
+    NegatableType atanh_wide_kernel(const NegatableType& x, std::true_type)
+    {
+      typedef minimax_log<minimax_helper<NegatableType>::tier> table_type;
+
+      return x * minimax_helper<NegatableType>::template polynomial<table_type>(x * x);
+    }
+
+    template<typename NegatableType>
+    NegatableType atanh_wide_kernel(const NegatableType& x, std::false_type)
+    {
+      return atanh_scaled_log(x);
+    }
+  } // namespace detail
+
+  /*! Compute inverse hyperbolic tangent atanh for fractional resolution > 24 bits. */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
-                                                                               typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x,
+                                                                                typename std::enable_if<24 <  (-FractionalResolution)>::type const*)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
 
     if(x.crepresentation() < 0)
     {
-      return -atan(-x);
+      // Handle negative argument.
+      return -atanh(-x);
     }
 
     local_negatable_type result;
 
     if(x.crepresentation() == 0)
     {
+      // Handle arguments identically equal to 0.
       result = local_negatable_type(0U);
     }
-    else if(x == local_negatable_type(1U))
-    {
-      result = ldexp(negatable_constants<local_negatable_type>::pi(), -2);
-    }
-    else if(x > local_negatable_type(1U))
+    else if(x >= 1)
     {
-      result = negatable_constants<local_negatable_type>::pi_half() - atan(1 / x);
+      // Handle arguments greater than or equal to 1.
+      result = (std::numeric_limits<local_negatable_type>::max)();
     }
-    else if(x < ldexp(local_negatable_type(1U), -3))
+    else if(x <= (3U - (negatable_constants<local_negatable_type>::root_two() * std::integral_constant<unsigned, 2U>())))
     {
-      const local_negatable_type one_half     = ldexp(local_negatable_type(1U), -1);
-      const local_negatable_type three_halves = ldexp(local_negatable_type(3U), -1);
-
-      // Use a hypergeometric series expansion for small argument.
-      result = x * detail::hypergeometric_2f1( local_negatable_type(1U),
-                                               one_half,
-                                               three_halves,
-                                              -(x * x));
+      result = detail::atanh_wide_kernel(x, typename detail::minimax_helper<local_negatable_type>::is_available());
     }
     else
     {
-      // Use Newton-Raphson iteration for atan.
-
-      // Obtain an initial guess using a two-term Pade approximation
-      // for atan(x). The coefficients for this Pade approximation
-      // have been specifically derived for this work.
-      result = (x * 3U) / (3U + (x * x));
-
-      // Do the Newton-Raphson iteration. Start with four binary digits
-      // of precision obtained from the initial guess above.
-      for(std::uint_fast16_t i = UINT16_C(4); i <= std::uint_fast16_t(local_negatable_type::all_bits / 2); i *= UINT16_C(2))
-      {
-        const local_negatable_type c = cos(result);
-        const local_negatable_type s = sin(result);
-
-        result += (c * ((x * c) - s));
-      }
+      result = detail::atanh_scaled_log(x);
     }
 
     return result;
   }
 
-  /*! Computes the arc tangent of y/x using the signs of arguments to determine the correct quadrant for any fractional resolution. 
-  */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  namespace detail
   {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    /*! The helper hypot_helper implements the integer square root of the
+        sum of the squares of two representations. The sum is held exactly
+        in a pair of unsigned_small_type, having twice the digits.
+    */
+    template<typename NegatableType>
+    struct hypot_helper
+    {
+      typedef typename NegatableType::unsigned_small_type unsigned_small_type;
+      typedef reciprocal_helper<NegatableType>            local_reciprocal_type;
+
+      BOOST_STATIC_CONSTEXPR int digits = std::numeric_limits<unsigned_small_type>::digits;
+
+      // Compute the square root of the non-zero pair s = (s_hi, s_lo), rounded
+      // to nearest if round_to_nearest is true, otherwise truncated.
+      static unsigned_small_type isqrt(const unsigned_small_type& s_hi,
+                                       const unsigned_small_type& s_lo,
+                                       const bool round_to_nearest)
+      {
+        // Normalize s = m * 2^n, with an even shift n, to a mantissa
+        // m = d * 2^digits, with 1/4 <= d < 1.
+        const int s_msb = ((s_hi != 0U) ? (digits + local_reciprocal_type::msb(s_hi))
+                                        : local_reciprocal_type::msb(s_lo));
 
-    // Handle the negative arguments and zero arguments.
-    const bool x_is_neg = (x.crepresentation() < 0);
+        int n = s_msb - (digits - 1);
 
-    if(y == 0)
-    {
-      return ((!x_is_neg) ? local_negatable_type(0U) : negatable_constants<local_negatable_type>::pi());
-    }
+        if((n % 2) != 0)
+        {
+          ++n;
+        }
 
-    const bool y_is_neg = (y < 0);
+        unsigned_small_type m;
 
-    if(x.crepresentation() == 0)
-    {
-      return ((!y_is_neg) ? negatable_constants<local_negatable_type>::pi_half() : -negatable_constants<local_negatable_type>::pi_half());
-    }
+        if     (n < 0)      { m = unsigned_small_type(s_lo << -n); }
+        else if(n == 0)     { m = s_lo; }
+        else if(n < digits) { m = unsigned_small_type(unsigned_small_type(s_lo >> n) | unsigned_small_type(s_hi << (digits - n))); }
+        else                { m = unsigned_small_type(s_hi >> (n - digits)); }
 
-    // Compute atan(y / x), thereby ignoring the sign of the arguments.
-    const local_negatable_type atan_term(atan(y / x));
+        // Here, d * (1 / sqrt(d)) = sqrt(d) is in the format Q1.(digits - 1),
+        // and sqrt(s) = sqrt(d) * 2^((digits + n) / 2). The approximation t
+        // is within a few units of its last place, including the bits of s
+        // dropped by the normalization.
+        const unsigned_small_type t = multiply_hi(m, local_reciprocal_type::rsqrt(m));
 
-    // Determine the proper quadrant based on signs of x and y.
-    return ((y_is_neg == x_is_neg) ? ((!x_is_neg) ? atan_term : (atan_term - negatable_constants<local_negatable_type>::pi()))
-                                   : ((!x_is_neg) ? atan_term : (atan_term + negatable_constants<local_negatable_type>::pi())));
-  }
+        const int right_shift = ((digits / 2) - 1) - (n / 2);
 
-  /*! Compute hyperbolic sine sinh. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+        unsigned_small_type r = ((right_shift >= 0) ? unsigned_small_type(t >> right_shift)
+                                                    : unsigned_small_type(t << -right_shift));
 
-    const local_negatable_type ep = exp(x);
-    const local_negatable_type em = 1U / ep;
+        // If the bits shifted out of t are far enough from the rounding
+        // boundary, the approximation already rounds correctly.
+        if(right_shift > 4)
+        {
+          const unsigned_small_type margin(8U);
+          const unsigned_small_type mask(unsigned_small_type(unsigned_small_type(1U) << right_shift) - 1U);
+          const unsigned_small_type f   (unsigned_small_type(t & mask));
 
-    return (ep - em) / 2U;
-  }
+          if(round_to_nearest)
+          {
+            const unsigned_small_type half(unsigned_small_type(unsigned_small_type(1U) << (right_shift - 1)));
 
-  /*! Compute hyperbolic cosine cosh. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+            if(unsigned_small_type(f + margin) < half) { return r; }
+            if(f > unsigned_small_type(half + margin)) { return unsigned_small_type(r + 1U); }
+          }
+          else
+          {
+            if((f > margin) && (f < unsigned_small_type(mask - margin))) { return r; }
+          }
+        }
 
-    const local_negatable_type ep = exp(x);
-    const local_negatable_type em = 1U / ep;
+        // Otherwise, form the remainder e = s - r^2, which is small and
+        // held as a two's complement pair, and correct the approximation
+        // to r^2 <= s < (r + 1)^2, using (r + 1)^2 = r^2 + r + (r + 1).
+        unsigned_small_type e_lo;
+        unsigned_small_type e_hi;
 
-    return (ep + em) / 2U;
-  }
+        multiply(r, r, e_lo, e_hi);
 
-  /*! Compute hyperbolic tangent tanh. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+        subtract(e_hi, e_lo, s_hi, s_lo);
+        negate  (e_hi, e_lo);
 
-    const local_negatable_type ep = exp(x);
-    const local_negatable_type em = 1 / ep;
+        while(unsigned_small_type(e_hi >> (digits - 1)) != 0U)
+        {
+          --r;
 
-    return (ep - em) / (ep + em);
-  }
+          add(e_hi, e_lo, r);
+          add(e_hi, e_lo, unsigned_small_type(r + 1U));
+        }
 
-  /*! Compute inverse hyperbolic sine asinh. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+        for(;;)
+        {
+          unsigned_small_type f_lo(e_lo);
+          unsigned_small_type f_hi(e_hi);
 
-    if(x.crepresentation() < 0)
-    {
-      // Handle negative argument.
-      return -asinh(-x);
-    }
+          subtract(f_hi, f_lo, unsigned_small_type(0U), r);
+          subtract(f_hi, f_lo, unsigned_small_type(0U), unsigned_small_type(r + 1U));
 
-    local_negatable_type result;
+          if(unsigned_small_type(f_hi >> (digits - 1)) != 0U)
+          {
+            break;
+          }
 
-    if(x.crepresentation() == 0)
-    {
-      result = local_negatable_type(0U);
-    }
-    else
-    {
-      if(x < ldexp(local_negatable_type(1U), -3))
+          ++r;
+
+          e_lo = f_lo;
+          e_hi = f_hi;
+        }
+
+        // Round to nearest. The root is rounded up if the sum exceeds
+        // r^2 + r + 1/4, i.e. if the remainder exceeds r.
+        // A tie can not occur since the sum is an integer.
+        if(round_to_nearest && ((e_hi != 0U) || (e_lo > r)))
+        {
+          ++r;
+        }
+
+        return r;
+      }
+
+      // Compute the sum s = (s_hi, s_lo) = (a * a) + (b * b),
+      // for a and b less than or equal to 2^(digits - 1).
+      static void sum_of_squares(const unsigned_small_type& a,
+                                 const unsigned_small_type& b,
+                                       unsigned_small_type& s_lo,
+                                       unsigned_small_type& s_hi)
       {
-        // Handle arguments greater than 0 but less than 1/8.
-        // Use a hypergeometric series representation here.
-        const local_negatable_type one_half     = ldexp(local_negatable_type(1U), -1);
-        const local_negatable_type three_halves = ldexp(local_negatable_type(3U), -1);
+        unsigned_small_type b2_lo;
+        unsigned_small_type b2_hi;
 
-        result = x * detail::hypergeometric_2f1(one_half, one_half, three_halves, -(x * x));
+        multiply(a, a, s_lo,  s_hi);
+        multiply(b, b, b2_lo, b2_hi);
+
+        s_lo = unsigned_small_type(s_lo + b2_lo);
+        s_hi = unsigned_small_type(s_hi + b2_hi + ((s_lo < b2_lo) ? 1U : 0U));
       }
-      else
+
+    private:
+    #if !defined(BOOST_FIXED_POINT_DISABLE_WIDE_INTEGER_MATH)
+
+      typedef typename NegatableType::unsigned_large_type unsigned_large_type;
+
+      // Compute the product u * v in the pair (result_hi, result_lo).
+      static void multiply(const unsigned_small_type& u,
+                           const unsigned_small_type& v,
+                                 unsigned_small_type& result_lo,
+                                 unsigned_small_type& result_hi)
       {
-        // Handle standard arguments greater than 0.
-        result = log(x + sqrt((x * x) + 1));
+        const unsigned_large_type p(unsigned_large_type(u) * unsigned_large_type(v));
+
+        result_lo = unsigned_small_type(p);
+        result_hi = unsigned_small_type(p >> digits);
       }
-    }
 
-    return result;
-  }
+    #else
 
-  /*! Compute inverse hyperbolic cosine acosh. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acosh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+      static void multiply(const unsigned_small_type& u,
+                           const unsigned_small_type& v,
+                                 unsigned_small_type& result_lo,
+                                 unsigned_small_type& result_hi)
+      {
+        detail::two_component_multiply<unsigned_small_type>(u, v, result_lo, result_hi);
+      }
 
-    local_negatable_type result;
+    #endif // BOOST_FIXED_POINT_DISABLE_WIDE_INTEGER_MATH
 
-    if(x <= 1)
-    {
-      // Handle arguments less than or equal to 1.
-      result = local_negatable_type(0U);
-    }
-    else
-    {
-      // Handle arguments greater than 1 but less than (1 + 1/8).
-      // Use a hypergeometric series representation here.
-      const local_negatable_type x_minus_one = x - 1;
+      // Add the unsigned u to the pair (p_hi, p_lo).
+      static void add(unsigned_small_type& p_hi, unsigned_small_type& p_lo, const unsigned_small_type& u)
+      {
+        p_lo = unsigned_small_type(p_lo + u);
+        p_hi = unsigned_small_type(p_hi + ((p_lo < u) ? 1U : 0U));
+      }
 
-      if(x_minus_one < ldexp(local_negatable_type(1U), -3))
+      // Subtract the pair (q_hi, q_lo) from the pair (p_hi, p_lo).
+      static void subtract(unsigned_small_type& p_hi, unsigned_small_type& p_lo, const unsigned_small_type& q_hi, const unsigned_small_type& q_lo)
       {
-        const local_negatable_type one_half     = ldexp(local_negatable_type(1U), -1);
-        const local_negatable_type three_halves = ldexp(local_negatable_type(3U), -1);
+        const unsigned_small_type borrow((p_lo < q_lo) ? 1U : 0U);
 
-        result =   sqrt(2 * x_minus_one)
-                 * detail::hypergeometric_2f1(one_half, one_half, three_halves, -x_minus_one / 2);
+        p_lo = unsigned_small_type(p_lo - q_lo);
+        p_hi = unsigned_small_type(p_hi - q_hi - borrow);
       }
-      else
+
+      // Negate the pair (p_hi, p_lo) in two's complement.
+      static void negate(unsigned_small_type& p_hi, unsigned_small_type& p_lo)
       {
-        // Handle standard arguments greater than 1.
-        result = log(x + sqrt((x * x) - 1));
+        p_hi = unsigned_small_type(unsigned_small_type(~p_hi) + ((p_lo == 0U) ? 1U : 0U));
+        p_lo = unsigned_small_type(unsigned_small_type(~p_lo) + 1U);
       }
-    }
 
-    return result;
+      static unsigned_small_type multiply_hi(const unsigned_small_type& u, const unsigned_small_type& v)
+      {
+        unsigned_small_type result_lo;
+        unsigned_small_type result_hi;
+
+        multiply(u, v, result_lo, result_hi);
+
+        return result_hi;
+      }
+    };
   }
 
-  /*! Compute inverse hyperbolic tan atanh. */
+  /*! Compute hypotenuse function.\n
+      The squares of the representations of x and y are summed exactly
+      in twice the digits of the representation, and the integer square root
+      of the sum is the representation of the result. There is no intermediate
+      overflow. The result is rounded to nearest, or truncated with round::fastest.
+      Results exceeding the range saturate at the maximum.
+  */
   template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x)
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> hypot(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y)
   {
     typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::unsigned_small_type                      local_unsigned_small_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+    typedef detail::hypot_helper<local_negatable_type>                              local_helper_type;
 
-    if(x.crepresentation() < 0)
-    {
-      // Handle negative argument.
-      return -atanh(-x);
-    }
+    const local_unsigned_small_type a((x.crepresentation() < 0) ? local_unsigned_small_type(-x.crepresentation()) : local_unsigned_small_type(x.crepresentation()));
+    const local_unsigned_small_type b((y.crepresentation() < 0) ? local_unsigned_small_type(-y.crepresentation()) : local_unsigned_small_type(y.crepresentation()));
 
-    local_negatable_type result;
+    local_unsigned_small_type r;
 
-    if(x.crepresentation() == 0)
-    {
-      // Handle arguments identically equal to 0.
-      result = local_negatable_type(0U);
-    }
-    else if(x >= 1)
+    if((a == 0U) || (b == 0U))
     {
-      // Handle arguments greater than or equal to 1.
-      result = (std::numeric_limits<local_negatable_type>::max)();
+      r = local_unsigned_small_type(a + b);
     }
     else
     {
-      if(x < ldexp(local_negatable_type(1U), -3))
-      {
-        // Handle small arguments greater than 0 but less than 1/8.
-        // Use a hypergeometric series representation here.
-        const local_negatable_type one_half     = ldexp(local_negatable_type(1U), -1);
-        const local_negatable_type three_halves = ldexp(local_negatable_type(3U), -1);
-
-        result = x * detail::hypergeometric_2f1(local_negatable_type(1U), one_half, three_halves, (x * x));
-      }
-      else
-      {
-        // Handle standard arguments greater than 0.
-        result = (log(1 + x) - log(1 - x)) / 2;
-      }
-    }
+      local_unsigned_small_type s_lo;
+      local_unsigned_small_type s_hi;
 
-    return result;
-  }
+      local_helper_type::sum_of_squares(a, b, s_lo, s_hi);
 
-  /*! Compute hypotenuse function. */
-  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
-  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> hypot(negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> x, negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> y)
-  {
-    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+      r = local_helper_type::isqrt(s_hi, s_lo, std::is_same<RoundMode, round::fastest>::value == false);
+    }
 
-    const local_negatable_type x2(x * x);
-    const local_negatable_type y2(y * y);
+    const local_unsigned_small_type max_value((std::numeric_limits<local_negatable_type>::max)().crepresentation());
 
-    return sqrt(x2 + y2);
+    return local_negatable_type(local_nothing(), local_value_type((r < max_value) ? r : max_value));
   }
 
   /*! copy sign function.
@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief CORDIC implementations of trigonometric, inverse trigonometric
+    and hyperbolic functions of fixed_point negatable.
+  \details The functions in namespace @c boost::fixed_point::cordic are alternatives
+    to the <cmath> functions of negatable. They use only shifts, additions and
+    table lookups on an integral working type, without multiplication or division.
+    This suits targets lacking a fast hardware multiplier.
+    The working type carries a few guard bits beyond the resolution of the
+    negatable type, and the result is rounded to nearest.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_CORDIC_2016_11_08_HPP_
+  #define FIXED_POINT_NEGATABLE_CORDIC_2016_11_08_HPP_
+
+  #include <boost/fixed_point/detail/fixed_point_detail_cordic.hpp>
+
+  namespace boost { namespace fixed_point {
+
+  namespace detail {
+
+  // Collect the working type, the tables and the conversions
+  // used by the CORDIC functions of a given negatable type.
+  template<typename NegatableType>
+  struct cordic_negatable_helper
+  {
+    BOOST_STATIC_CONSTEXPR int guard_bits      = 6;
+    BOOST_STATIC_CONSTEXPR int fractional_bits = NegatableType::radix_split + guard_bits;
+
+    // The integral bits hold the input range plus the growth
+    // of the CORDIC gain and the argument reduction.
+    BOOST_STATIC_CONSTEXPR int integral_bits   = NegatableType::range + 3;
+
+    BOOST_STATIC_CONSTEXPR int iterations      = fractional_bits;
+
+    typedef typename integer_type_helper<std::uint32_t(1 + integral_bits + fractional_bits)>::exact_signed_type work_type;
+
+    #if defined(BOOST_FIXED_POINT_DISABLE_MULTIPRECISION)
+      static_assert((1 + integral_bits + fractional_bits) <= 64,
+                    "Error: The CORDIC working type of this negatable type exceeds 64 bits.");
+    #endif
+
+    typedef cordic_table<work_type, fractional_bits> table_type;
+
+    static work_type one() { return work_type(work_type(1) << fractional_bits); }
+
+    static work_type to_work(const NegatableType& x)
+    {
+      return work_type(work_type(x.crepresentation()) * work_type(work_type(1) << guard_bits));
+    }
+
+    static NegatableType from_work(const work_type& w)
+    {
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
+
+      const bool      is_neg = (w < 0);
+      const work_type u      = (is_neg ? work_type(-w) : w);
+      const work_type r      = work_type((u + work_type(work_type(1) << (guard_bits - 1))) >> guard_bits);
+
+      return NegatableType(local_nothing(), local_value_type(is_neg ? work_type(-r) : r));
+    }
+
+    // Compute sin(t) and cos(t) for t >= 0 in the working type.
+    static void sin_cos(work_type t, work_type& s, work_type& c)
+    {
+      // Reduce the argument to t = (q * pi/2) + r, with 0 <= r < pi/2,
+      // using shift-and-subtract. Only the quadrant q modulo 4 is needed.
+      unsigned q = 0U;
+
+      for(int j = NegatableType::range + 1; j >= 0; --j)
+      {
+        const work_type step = work_type(table_type::pi_half() << j);
+
+        if(!(t < step))
+        {
+          t -= step;
+          q  = (q + ((j < 2) ? (1U << j) : 0U)) & 3U;
+        }
+      }
+
+      work_type x = table_type::circular_gain_inverse();
+      work_type y = work_type(0);
+
+      cordic_circular_rotate<table_type>(x, y, t, iterations);
+
+      switch(q)
+      {
+        case 0U:  s =  y;            c =  x;            break;
+        case 1U:  s =  x;            c = work_type(-y); break;
+        case 2U:  s = work_type(-y); c = work_type(-x); break;
+        default:  s = work_type(-x); c =  y;            break;
+      }
+    }
+
+    // Compute sinh(t) and cosh(t) for t >= 0 in the working type.
+    static void sinh_cosh(work_type t, work_type& sh, work_type& ch)
+    {
+      // Reduce the argument to t = (n * ln2) + r, with 0 <= r < ln2,
+      // using shift-and-subtract. Arguments beyond the range of the
+      // negatable type overflow, so n is limited to range + 2.
+      int j_max = 0;
+
+      while((1 << (j_max + 1)) <= (NegatableType::range + 2)) { ++j_max; }
+
+      int n = 0;
+
+      for(int j = j_max; j >= 0; --j)
+      {
+        const work_type step = work_type(table_type::ln_two() << j);
+
+        if(!(t < step))
+        {
+          t -= step;
+          n += (1 << j);
+        }
+      }
+
+      if(n > (NegatableType::range + 2)) { n = NegatableType::range + 2; }
+
+      work_type x = table_type::hyperbolic_gain_inverse();
+      work_type y = work_type(0);
+
+      cordic_hyperbolic_rotate<table_type>(x, y, t, iterations);
+
+      // Here, x = cosh(r) and y = sinh(r). Scale exp(+r) and exp(-r)
+      // by 2^n and 2^-n to obtain exp(+t) and exp(-t).
+      const work_type exp_pos = work_type(work_type(x + y) << n);
+      const work_type exp_neg = work_type(work_type(x - y) >> n);
+
+      sh = work_type(work_type(exp_pos - exp_neg) >> 1);
+      ch = work_type(work_type(exp_pos + exp_neg) >> 1);
+    }
+  };
+
+  } // namespace detail
+
+  namespace cordic {
+
+  //! CORDIC sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+
+    const local_work_type t        = local_helper_type::to_work(x);
+    const bool            x_is_neg = (t < 0);
+
+    local_work_type s;
+    local_work_type c;
+
+    local_helper_type::sin_cos(x_is_neg ? local_work_type(-t) : t, s, c);
+
+    return local_helper_type::from_work(x_is_neg ? local_work_type(-s) : s);
+  }
+
+  //! CORDIC cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+
+    const local_work_type t = local_helper_type::to_work(x);
+
+    local_work_type s;
+    local_work_type c;
+
+    local_helper_type::sin_cos((t < 0) ? local_work_type(-t) : t, s, c);
+
+    return local_helper_type::from_work(c);
+  }
+
+  //! CORDIC arc-tangent of negatable, using vectoring mode.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+    typedef typename local_helper_type::table_type                                   local_table_type;
+
+    local_work_type u = local_helper_type::one();
+    local_work_type v = local_helper_type::to_work(x);
+    local_work_type z = local_work_type(0);
+
+    detail::cordic_circular_vector<local_table_type>(u, v, z, local_helper_type::iterations);
+
+    return local_helper_type::from_work(z);
+  }
+
+  //! CORDIC arc-tangent of y / x of negatable in the range [-pi, pi], using vectoring mode.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& y,
+                                                                                const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+    typedef typename local_helper_type::table_type                                   local_table_type;
+
+    if((x == 0) && (y == 0))
+    {
+      return local_negatable_type(0);
+    }
+
+    local_work_type u = local_helper_type::to_work(x);
+    local_work_type v = local_helper_type::to_work(y);
+    local_work_type z = local_work_type(0);
+
+    // Scale short vectors up, so that the truncation of the
+    // shifted components does not limit the angular precision.
+    const local_work_type u_limit = local_work_type(local_helper_type::one() << IntegralRange);
+
+    while(   (((u < 0) ? local_work_type(-u) : u) < u_limit)
+          && (((v < 0) ? local_work_type(-v) : v) < u_limit))
+    {
+      u *= 2;
+      v *= 2;
+    }
+
+    if(x < 0)
+    {
+      // Rotate the vector by pi into the right half-plane.
+      const local_work_type pi = local_work_type(local_table_type::pi_half() * 2);
+
+      z = ((y < 0) ? local_work_type(-pi) : pi);
+      u = local_work_type(-u);
+      v = local_work_type(-v);
+    }
+
+    detail::cordic_circular_vector<local_table_type>(u, v, z, local_helper_type::iterations);
+
+    return local_helper_type::from_work(z);
+  }
+
+  //! CORDIC hypotenuse sqrt(x^2 + y^2) of negatable, using vectoring mode.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> hypot(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x,
+                                                                                const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& y)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+    typedef typename local_helper_type::table_type                                   local_table_type;
+
+    local_work_type u = local_helper_type::to_work(x);
+    local_work_type v = local_helper_type::to_work(y);
+    local_work_type z = local_work_type(0);
+
+    if(u < 0) { u = local_work_type(-u); }
+    if(v < 0) { v = local_work_type(-v); }
+
+    detail::cordic_circular_vector<local_table_type>(u, v, z, local_helper_type::iterations);
+
+    // Remove the circular CORDIC gain with shifts and additions.
+    return local_helper_type::from_work(detail::cordic_scale(u,
+                                                             local_table_type::circular_gain_inverse(),
+                                                             local_helper_type::fractional_bits));
+  }
+
+  //! CORDIC hyperbolic sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+
+    const local_work_type t        = local_helper_type::to_work(x);
+    const bool            x_is_neg = (t < 0);
+
+    local_work_type sh;
+    local_work_type ch;
+
+    local_helper_type::sinh_cosh(x_is_neg ? local_work_type(-t) : t, sh, ch);
+
+    return local_helper_type::from_work(x_is_neg ? local_work_type(-sh) : sh);
+  }
+
+  //! CORDIC hyperbolic cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::cordic_negatable_helper<local_negatable_type>                    local_helper_type;
+    typedef typename local_helper_type::work_type                                    local_work_type;
+
+    const local_work_type t = local_helper_type::to_work(x);
+
+    local_work_type sh;
+    local_work_type ch;
+
+    local_helper_type::sinh_cosh((t < 0) ? local_work_type(-t) : t, sh, ch);
+
+    return local_helper_type::from_work(ch);
+  }
+
+  } // namespace cordic
+
+  } } // namespace boost::fixed_point
+
+#endif // FIXED_POINT_NEGATABLE_CORDIC_2016_11_08_HPP_
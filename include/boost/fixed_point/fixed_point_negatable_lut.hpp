@@ -0,0 +1,315 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief Table-plus-interpolation implementations of elementary functions
+    of fixed_point negatable having low resolution.
+  \details The functions in namespace @c boost::fixed_point::lut are alternatives
+    to the <cmath> functions of negatable for types having up to 32 bits
+    and a resolution of up to 24 fractional bits.
+    Each function reduces its argument to the interval [0, 1] with shifts
+    and (at most) one multiplication or division, and linearly interpolates
+    a table of 2^8 to 2^12 elements. The tables are computed once per
+    negatable type on first use. The initialization is thread-safe.
+    The maximum error of @c sin, @c cos, @c log and @c atan is one unit
+    of the resolution. The error of @c exp and @c sqrt is one unit
+    of the resolution relative to the result.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_LUT_2016_11_09_HPP_
+  #define FIXED_POINT_NEGATABLE_LUT_2016_11_09_HPP_
+
+  #include <array>
+  #include <cmath>
+  #include <cstddef>
+  #include <cstdint>
+
+  namespace boost { namespace fixed_point {
+
+  namespace detail {
+
+  // Collect the tables, the interpolation and the conversions
+  // used by the table-based functions of a given negatable type.
+  template<typename NegatableType>
+  struct lut_negatable_helper
+  {
+    static_assert((NegatableType::all_bits <= 32) && (NegatableType::radix_split <= 24),
+                  "Error: The table-based functions require a negatable type having at most 32 bits and at most 24 fractional bits.");
+
+    // The table elements carry a few guard bits beyond the resolution.
+    BOOST_STATIC_CONSTEXPR int guard_bits      = 4;
+    BOOST_STATIC_CONSTEXPR int fractional_bits = NegatableType::radix_split + guard_bits;
+
+    // Select the table size such that the linear interpolation error
+    // is well below the resolution, with 2^8 to 2^12 elements.
+    BOOST_STATIC_CONSTEXPR int table_bits      = (((NegatableType::radix_split + 2) / 2) < 8)  ?  8 :
+                                                 (((NegatableType::radix_split + 2) / 2) > 12) ? 12 :
+                                                  ((NegatableType::radix_split + 2) / 2);
+
+    // The reduced argument in [0, 1] has table_bits bits of index
+    // and fractional_bits bits for the interpolation.
+    BOOST_STATIC_CONSTEXPR int position_bits   = fractional_bits + table_bits;
+
+    // There are two elements beyond the end of the interval [0, 1],
+    // so that the interpolation at exactly 1 stays within the table.
+    typedef std::array<std::int32_t, std::size_t((1UL << table_bits) + 2U)> table_type;
+
+    template<typename FunctionType>
+    static table_type make_table(FunctionType function)
+    {
+      using std::floor;
+      using std::ldexp;
+
+      table_type table;
+
+      for(std::size_t k = 0U; k < table.size(); ++k)
+      {
+        const long double u = ldexp(static_cast<long double>(k), -table_bits);
+
+        table[k] = static_cast<std::int32_t>(floor(ldexp(function(u), fractional_bits) + 0.5L));
+      }
+
+      return table;
+    }
+
+    // Linearly interpolate the table at u in [0, 1], where u has position_bits fractional bits.
+    // The result has fractional_bits fractional bits.
+    static std::int64_t interpolate(const table_type& table, const std::uint64_t u)
+    {
+      const std::size_t  index = std::size_t(u >> fractional_bits);
+      const std::int64_t frac  = std::int64_t(u & ((UINT64_C(1) << fractional_bits) - 1U));
+
+      const std::int64_t f0    = std::int64_t(table[index]);
+      const std::int64_t delta = std::int64_t(table[index + 1U]) - f0;
+
+      return f0 + (((delta * frac) + (INT64_C(1) << (fractional_bits - 1))) >> fractional_bits);
+    }
+
+    static std::uint64_t magnitude(const NegatableType& x)
+    {
+      const std::int64_t x_raw = std::int64_t(x.crepresentation());
+
+      return std::uint64_t((x_raw < 0) ? -x_raw : x_raw);
+    }
+
+    // Round the value v * 2^n to the negatable type,
+    // where v has fractional_bits fractional bits.
+    static NegatableType scale(const std::int64_t v, const int n)
+    {
+      typedef typename NegatableType::value_type local_value_type;
+      typedef typename NegatableType::nothing    local_nothing;
+
+      const bool    is_neg = (v < 0);
+      std::uint64_t u      = std::uint64_t(is_neg ? -v : v);
+
+      const int shift = n - guard_bits;
+
+      if(shift >= 0)
+      {
+        // Results beyond the range of the negatable type overflow.
+        u <<= ((shift < 32) ? shift : 32);
+      }
+      else
+      {
+        u = ((-shift < 63) ? ((u + (UINT64_C(1) << (-shift - 1))) >> -shift) : UINT64_C(0));
+      }
+
+      return NegatableType(local_nothing(), local_value_type(is_neg ? -std::int64_t(u) : std::int64_t(u)));
+    }
+
+    static std::int64_t pi_half()      { return std::int64_t(UINT64_C(0x6487ED5110B4611A) >> (62 - fractional_bits)); }
+
+    // The value of ln2 has eight bits beyond fractional_bits.
+    static std::int64_t ln_two_extra() { return std::int64_t(UINT64_C(0x58B90BFBE8E7BCD6) >> (55 - fractional_bits)); }
+
+    static std::int64_t sin_or_cos(const NegatableType& x, const bool is_cos)
+    {
+      static const table_type table = make_table([](const long double u) -> long double { using std::sin; return sin(u * 1.57079632679489661923132169163975144L); });
+
+      // Compute the phase x * 2/pi in units of quadrants.
+      // The value of 2/pi has 32 fractional bits.
+      const std::uint64_t u = (magnitude(x) * UINT64_C(0xA2F9836E)) >> ((NegatableType::radix_split + 32) - position_bits);
+
+      const std::uint64_t mask = (UINT64_C(1) << position_bits) - 1U;
+      const std::uint64_t f    = u & mask;
+      const unsigned      q    = unsigned((u >> position_bits) + (is_cos ? 1U : 0U)) & 3U;
+
+      const std::int64_t s = interpolate(table, (((q & 1U) != 0U) ? ((mask + 1U) - f) : f));
+
+      return (((q & 2U) != 0U) ? -s : s);
+    }
+  };
+
+  } // namespace detail
+
+  namespace lut {
+
+  //! Table-based sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    const std::int64_t s = local_helper_type::sin_or_cos(x, false);
+
+    return local_helper_type::scale(((x < 0) ? -s : s), 0);
+  }
+
+  //! Table-based cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    return local_helper_type::scale(local_helper_type::sin_or_cos(x, true), 0);
+  }
+
+  //! Table-based exponential function of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    static const typename local_helper_type::table_type table =
+      local_helper_type::make_table([](const long double u) -> long double { using std::exp2; return exp2(u); });
+
+    // Compute x / ln2 = n + f, with 0 <= f < 1, and exp(x) = 2^n * 2^f.
+    // The value of 1/ln2 has 31 fractional bits.
+    const std::uint64_t u = (local_helper_type::magnitude(x) * UINT64_C(0xB8AA3B29)) >> ((local_negatable_type::radix_split + 31) - local_helper_type::position_bits);
+
+    const std::uint64_t mask = (UINT64_C(1) << local_helper_type::position_bits) - 1U;
+
+    std::int64_t  n = std::int64_t(u >> local_helper_type::position_bits);
+    std::uint64_t f = u & mask;
+
+    if((x < 0) && (f != 0U))
+    {
+      n = -n - 1;
+      f = (mask + 1U) - f;
+    }
+    else if(x < 0)
+    {
+      n = -n;
+    }
+
+    // Results below the resolution underflow to zero.
+    const int n_limited = ((n < -64) ? -64 : ((n > 64) ? 64 : int(n)));
+
+    return local_helper_type::scale(local_helper_type::interpolate(table, f), n_limited);
+  }
+
+  //! Table-based natural logarithm of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    static const typename local_helper_type::table_type table =
+      local_helper_type::make_table([](const long double u) -> long double { using std::log1p; return log1p(u); });
+
+    if(x <= 0)
+    {
+      return -(std::numeric_limits<local_negatable_type>::max)();
+    }
+
+    // Compute x = 2^e * (1 + f), with 0 <= f < 1, and log(x) = (e * ln2) + log(1 + f).
+    std::uint32_t u    = std::uint32_t(x.crepresentation());
+    std::uint32_t mask = (std::numeric_limits<std::uint32_t>::max)();
+
+    const int m = int(detail::msb_helper(u, mask, std::uint_fast16_t(32U)));
+
+    const std::uint64_t f_raw = std::uint64_t(x.crepresentation()) - (UINT64_C(1) << m);
+
+    const std::uint64_t f = ((m <= local_helper_type::position_bits) ? (f_raw << (local_helper_type::position_bits - m))
+                                                                     : (f_raw >> (m - local_helper_type::position_bits)));
+
+    const std::int64_t e = std::int64_t(m - local_negatable_type::radix_split);
+
+    const std::int64_t e_ln_two = ((e * local_helper_type::ln_two_extra()) + INT64_C(128)) / INT64_C(256);
+
+    return local_helper_type::scale(e_ln_two + local_helper_type::interpolate(table, f), 0);
+  }
+
+  //! Table-based square root of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    static const typename local_helper_type::table_type table_even =
+      local_helper_type::make_table([](const long double u) -> long double { using std::sqrt; return sqrt(1.0L + u); });
+
+    static const typename local_helper_type::table_type table_odd =
+      local_helper_type::make_table([](const long double u) -> long double { using std::sqrt; return sqrt(2.0L * (1.0L + u)); });
+
+    if(x <= 0)
+    {
+      return local_negatable_type(0U);
+    }
+
+    // Compute x = 2^e * (1 + f), with 0 <= f < 1, and take
+    // sqrt(x) = 2^(e/2) * sqrt(1 + f) for even e, or else
+    // sqrt(x) = 2^((e-1)/2) * sqrt(2 * (1 + f)) for odd e.
+    std::uint32_t u    = std::uint32_t(x.crepresentation());
+    std::uint32_t mask = (std::numeric_limits<std::uint32_t>::max)();
+
+    const int m = int(detail::msb_helper(u, mask, std::uint_fast16_t(32U)));
+
+    const std::uint64_t f_raw = std::uint64_t(x.crepresentation()) - (UINT64_C(1) << m);
+
+    const std::uint64_t f = ((m <= local_helper_type::position_bits) ? (f_raw << (local_helper_type::position_bits - m))
+                                                                     : (f_raw >> (m - local_helper_type::position_bits)));
+
+    const int  e        = m - local_negatable_type::radix_split;
+    const bool e_is_odd = ((e % 2) != 0);
+
+    return local_helper_type::scale(local_helper_type::interpolate((e_is_odd ? table_odd : table_even), f),
+                                    (e_is_odd ? (e - 1) : e) / 2);
+  }
+
+  //! Table-based arc-tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef detail::lut_negatable_helper<local_negatable_type>                       local_helper_type;
+
+    static const typename local_helper_type::table_type table =
+      local_helper_type::make_table([](const long double u) -> long double { using std::atan; return atan(u); });
+
+    const std::uint64_t x_mag = local_helper_type::magnitude(x);
+    const std::uint64_t one   = UINT64_C(1) << local_negatable_type::radix_split;
+
+    std::int64_t a;
+
+    if(x_mag <= one)
+    {
+      a = local_helper_type::interpolate(table, x_mag << (local_helper_type::position_bits - local_negatable_type::radix_split));
+    }
+    else
+    {
+      // Use atan(x) = pi/2 - atan(1/x) for |x| > 1.
+      const std::uint64_t numerator = UINT64_C(1) << (local_helper_type::fractional_bits + local_negatable_type::radix_split);
+
+      const std::uint64_t u = ((numerator + (x_mag / 2U)) / x_mag) << local_helper_type::table_bits;
+
+      a = local_helper_type::pi_half() - local_helper_type::interpolate(table, u);
+    }
+
+    return local_helper_type::scale(((x < 0) ? -a : a), 0);
+  }
+
+  } // namespace lut
+
+  } } // namespace boost::fixed_point
+
+#endif // FIXED_POINT_NEGATABLE_LUT_2016_11_09_HPP_
@@ -0,0 +1,484 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief Elementary functions of fixed_point negatable with an explicit
+    trade of accuracy for speed, independently of the resolution of the type.
+  \details The <cmath> functions of negatable select their algorithms
+    from the fractional resolution of the type, with tiers for up to 11,
+    up to 24 and more than 24 fractional bits. The functions in namespace
+    @c boost::fixed_point::fast evaluate the algorithms of the next lower tier,
+    with 24 or 11 fractional bits, and the functions in namespace
+    @c boost::fixed_point::accurate evaluate the algorithms with eight
+    guard bits beyond the resolution of the type. The argument is converted
+    to a working type having the same range and the fractional resolution
+    of the policy, and the result is rounded back to the type of the argument.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_POLICY_2016_11_16_HPP_
+  #define FIXED_POINT_NEGATABLE_POLICY_2016_11_16_HPP_
+
+  namespace boost { namespace fixed_point {
+
+  namespace detail {
+
+  // Select the working types of the policy-based functions of a given negatable type.
+  template<typename NegatableType>
+  struct policy_helper;
+
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  struct policy_helper<negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>>
+  {
+    // The fast working type has the resolution of the next lower tier
+    // of the algorithms. Types in the lowest tier are used as they are.
+    BOOST_STATIC_CONSTEXPR int fast_resolution = ((-FractionalResolution) > 24) ? -24 :
+                                                 ((-FractionalResolution) > 11) ? -11 :
+                                                   FractionalResolution;
+
+    // The accurate working type has guard bits beyond the resolution,
+    // such that the rounding of the result dominates its error.
+    BOOST_STATIC_CONSTEXPR int guard_bits          = 8;
+    BOOST_STATIC_CONSTEXPR int accurate_resolution = FractionalResolution - guard_bits;
+
+    typedef negatable<IntegralRange, fast_resolution,     RoundMode, OverflowMode> fast_type;
+    typedef negatable<IntegralRange, accurate_resolution, RoundMode, OverflowMode> accurate_type;
+  };
+
+  } // namespace detail
+
+
+  namespace fast {
+
+  //! Fast square root of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sqrt(local_working_type(x)));
+  }
+
+  //! Fast exponential function of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::exp(local_working_type(x)));
+  }
+
+  //! Fast base-2 exponential function of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::exp2(local_working_type(x)));
+  }
+
+  //! Fast exp(x) - 1 of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::expm1(local_working_type(x)));
+  }
+
+  //! Fast natural logarithm of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log(local_working_type(x)));
+  }
+
+  //! Fast base-2 logarithm of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log2(local_working_type(x)));
+  }
+
+  //! Fast log(1 + x) of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log1p(local_working_type(x)));
+  }
+
+  //! Fast sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sin(local_working_type(x)));
+  }
+
+  //! Fast cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::cos(local_working_type(x)));
+  }
+
+  //! Fast tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::tan(local_working_type(x)));
+  }
+
+  //! Fast arc-sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::asin(local_working_type(x)));
+  }
+
+  //! Fast arc-cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::acos(local_working_type(x)));
+  }
+
+  //! Fast arc-tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atan(local_working_type(x)));
+  }
+
+  //! Fast hyperbolic sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sinh(local_working_type(x)));
+  }
+
+  //! Fast hyperbolic cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::cosh(local_working_type(x)));
+  }
+
+  //! Fast hyperbolic tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tanh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::tanh(local_working_type(x)));
+  }
+
+  //! Fast inverse hyperbolic sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::asinh(local_working_type(x)));
+  }
+
+  //! Fast inverse hyperbolic cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acosh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::acosh(local_working_type(x)));
+  }
+
+  //! Fast inverse hyperbolic tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atanh(local_working_type(x)));
+  }
+
+  //! Fast arc-tangent of y / x of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& y, const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atan2(local_working_type(y), local_working_type(x)));
+  }
+
+  //! Fast power x^a of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x, const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& a)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::fast_type         local_working_type;
+
+    return local_negatable_type(boost::fixed_point::pow(local_working_type(x), local_working_type(a)));
+  }
+
+  } // namespace fast
+
+  namespace accurate {
+
+  //! Accurate square root of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sqrt(local_working_type(x)));
+  }
+
+  //! Accurate exponential function of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::exp(local_working_type(x)));
+  }
+
+  //! Accurate base-2 exponential function of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> exp2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::exp2(local_working_type(x)));
+  }
+
+  //! Accurate exp(x) - 1 of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> expm1(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::expm1(local_working_type(x)));
+  }
+
+  //! Accurate natural logarithm of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log(local_working_type(x)));
+  }
+
+  //! Accurate base-2 logarithm of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log2(local_working_type(x)));
+  }
+
+  //! Accurate log(1 + x) of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> log1p(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::log1p(local_working_type(x)));
+  }
+
+  //! Accurate sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sin(local_working_type(x)));
+  }
+
+  //! Accurate cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::cos(local_working_type(x)));
+  }
+
+  //! Accurate tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::tan(local_working_type(x)));
+  }
+
+  //! Accurate arc-sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asin(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::asin(local_working_type(x)));
+  }
+
+  //! Accurate arc-cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acos(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::acos(local_working_type(x)));
+  }
+
+  //! Accurate arc-tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atan(local_working_type(x)));
+  }
+
+  //! Accurate hyperbolic sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sinh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::sinh(local_working_type(x)));
+  }
+
+  //! Accurate hyperbolic cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> cosh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::cosh(local_working_type(x)));
+  }
+
+  //! Accurate hyperbolic tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> tanh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::tanh(local_working_type(x)));
+  }
+
+  //! Accurate inverse hyperbolic sine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> asinh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::asinh(local_working_type(x)));
+  }
+
+  //! Accurate inverse hyperbolic cosine of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> acosh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::acosh(local_working_type(x)));
+  }
+
+  //! Accurate inverse hyperbolic tangent of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atanh(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atanh(local_working_type(x)));
+  }
+
+  //! Accurate arc-tangent of y / x of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> atan2(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& y, const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::atan2(local_working_type(y), local_working_type(x)));
+  }
+
+  //! Accurate power x^a of negatable.
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> pow(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x, const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& a)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename detail::policy_helper<local_negatable_type>::accurate_type     local_working_type;
+
+    return local_negatable_type(boost::fixed_point::pow(local_working_type(x), local_working_type(a)));
+  }
+
+  } // namespace accurate
+
+  } } // namespace boost::fixed_point
+
+#endif // FIXED_POINT_NEGATABLE_POLICY_2016_11_16_HPP_
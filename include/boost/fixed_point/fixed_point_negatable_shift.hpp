@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*!
+  \file
+  \brief Shift-and-subtract implementations of functions of fixed_point negatable.
+  \details The functions in namespace @c boost::fixed_point::shift are alternatives
+    to the <cmath> functions of negatable. They use digit recurrences on the
+    integral representation with only shifts, subtractions and comparisons,
+    without multiplication or division. This suits targets lacking a fast
+    hardware multiplier. The results are exact or correctly rounded to nearest.
+*/
+
+#ifndef FIXED_POINT_NEGATABLE_SHIFT_2016_11_14_HPP_
+  #define FIXED_POINT_NEGATABLE_SHIFT_2016_11_14_HPP_
+
+  #include <cstdint>
+  #include <limits>
+
+  namespace boost { namespace fixed_point {
+
+  namespace shift {
+
+  /*! Square root of negatable, correctly rounded to nearest.\n
+      The digit recurrence forms the integer square root of the radicand
+      (representation * 2^radix_split) and consumes two bits of the radicand
+      (one radix-4 digit) per step. It terminates early when the remaining
+      radicand and the partial remainder are zero, i.e. for exact squares.
+      Arguments less than or equal to zero result in zero.
+      The recurrence is adapted from Ken Turkowski's algorithm.
+      \sa http://www.realitypixels.com/turk/computergraphics/FixedSqrt.pdf
+  */
+  template<const int IntegralRange, const int FractionalResolution, typename RoundMode, typename OverflowMode>
+  negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> sqrt(const negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode>& x)
+  {
+    typedef negatable<IntegralRange, FractionalResolution, RoundMode, OverflowMode> local_negatable_type;
+    typedef typename local_negatable_type::unsigned_small_type                      local_unsigned_small_type;
+    typedef typename local_negatable_type::value_type                               local_value_type;
+    typedef typename local_negatable_type::nothing                                  local_nothing;
+
+    if(x.crepresentation() <= 0)
+    {
+      return local_negatable_type(0U);
+    }
+
+    // The recurrence works on the digits of the unsigned type, which
+    // can be wider than the number of bits of the negatable type.
+    BOOST_CONSTEXPR_OR_CONST int total_bits    = std::numeric_limits<local_unsigned_small_type>::digits;
+    BOOST_CONSTEXPR_OR_CONST int radicand_bits = total_bits + local_negatable_type::radix_split;
+
+    // The radicand is processed in pairs of bits aligned to its least significant bit.
+    // For an odd number of bits, the most significant bit is skipped. This is
+    // possible because the most significant bit of the positive representation is zero.
+    BOOST_CONSTEXPR_OR_CONST int skipped_bits  = (radicand_bits % 2);
+
+    local_unsigned_small_type root  (0U);
+    local_unsigned_small_type rem_hi(0U);
+    local_unsigned_small_type rem_lo(local_unsigned_small_type(local_unsigned_small_type(x.crepresentation()) << skipped_bits));
+
+    bool is_exact = false;
+
+    for(std::uint_fast16_t count = std::uint_fast16_t(radicand_bits / 2); count > 0U; --count)
+    {
+      if((rem_lo == 0U) && (rem_hi == 0U))
+      {
+        // The remaining digits of the root are zero.
+        root = local_unsigned_small_type(root << count);
+
+        is_exact = true;
+
+        break;
+      }
+
+      // The partial remainder is at most twice the partial root, whereby the
+      // shift below can exceed the unsigned type for types with very small
+      // range. In this case, the remainder is known to exceed the trial divisor.
+      const bool rem_hi_overflows = (local_unsigned_small_type(rem_hi >> (total_bits - 2)) != 0U);
+
+      // Bring down the next radix-4 digit of the radicand.
+      rem_hi = local_unsigned_small_type(local_unsigned_small_type(rem_hi << 2) | local_unsigned_small_type(rem_lo >> (total_bits - 2)));
+      rem_lo = local_unsigned_small_type(rem_lo << 2);
+
+      root = local_unsigned_small_type(root << 1);
+
+      // Test the trial divisor (2 * root) + 1.
+      const local_unsigned_small_type trial = local_unsigned_small_type(local_unsigned_small_type(root << 1) | 1U);
+
+      if(rem_hi_overflows || (rem_hi >= trial))
+      {
+        rem_hi = local_unsigned_small_type(rem_hi - trial);
+
+        ++root;
+      }
+    }
+
+    // Round to nearest. The root is rounded up if the radicand exceeds
+    // root^2 + root + 1/4, i.e. if the remainder exceeds the root.
+    // A tie can not occur since the radicand is an integer.
+    if((!is_exact) && (rem_hi > root))
+    {
+      const local_unsigned_small_type root_max =
+        local_unsigned_small_type((std::numeric_limits<local_negatable_type>::max)().crepresentation());
+
+      if(root < root_max)
+      {
+        ++root;
+      }
+    }
+
+    return local_negatable_type(local_nothing(), local_value_type(root));
+  }
+
+  } // namespace shift
+
+  } } // namespace boost::fixed_point
+
+#endif // FIXED_POINT_NEGATABLE_SHIFT_2016_11_14_HPP_
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests compile-time bit-growth type deduction and exact arithmetic of fixed_point negatable.
+
+#include <type_traits>
+
+#define BOOST_TEST_MODULE test_negatable_basic_bit_growth
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_negatable_basic_bit_growth)
+{
+  typedef boost::fixed_point::negatable<3,  -4> fixed_point_type_a;
+  typedef boost::fixed_point::negatable<2,  -5> fixed_point_type_b;
+  typedef boost::fixed_point::negatable<7, -24> fixed_point_type_c;
+
+  using boost::fixed_point::bit_growth_add;
+  using boost::fixed_point::bit_growth_subtract;
+  using boost::fixed_point::bit_growth_multiply;
+  using boost::fixed_point::bit_growth_accumulate;
+
+  static_assert(std::is_same<bit_growth_add<fixed_point_type_a, fixed_point_type_b>::type,
+                             boost::fixed_point::negatable<4, -5>>::value, "Error: Wrong bit growth of add.");
+
+  static_assert(std::is_same<bit_growth_subtract<fixed_point_type_b, fixed_point_type_a>::type,
+                             boost::fixed_point::negatable<4, -5>>::value, "Error: Wrong bit growth of subtract.");
+
+  static_assert(std::is_same<bit_growth_multiply<fixed_point_type_a, fixed_point_type_b>::type,
+                             boost::fixed_point::negatable<5, -9>>::value, "Error: Wrong bit growth of multiply.");
+
+  static_assert(std::is_same<bit_growth_accumulate<fixed_point_type_a, 1U>::type,
+                             fixed_point_type_a>::value, "Error: Wrong bit growth of accumulate.");
+
+  static_assert(std::is_same<bit_growth_accumulate<fixed_point_type_a, 5U>::type,
+                             boost::fixed_point::negatable<6, -4>>::value, "Error: Wrong bit growth of accumulate.");
+
+  static_assert(std::is_same<bit_growth_accumulate<fixed_point_type_a, 8U>::type,
+                             boost::fixed_point::negatable<6, -4>>::value, "Error: Wrong bit growth of accumulate.");
+
+  // The 8-bit and 9-bit operands of a*b + c*d need a 16-bit result.
+  static_assert(bit_growth_add<bit_growth_multiply<fixed_point_type_a, fixed_point_type_b>::type,
+                               bit_growth_multiply<fixed_point_type_a, fixed_point_type_b>::type>::type::all_bits == 16,
+                "Error: Wrong bit growth of a*b + c*d.");
+
+  {
+    // Products and sums near the edges of the operand ranges do not overflow.
+    const fixed_point_type_a a = (std::numeric_limits<fixed_point_type_a>::max)();
+    const fixed_point_type_b b = (std::numeric_limits<fixed_point_type_b>::max)();
+
+    const auto ab = boost::fixed_point::exact_multiply(a, b);
+    const auto s  = boost::fixed_point::exact_add(ab, boost::fixed_point::exact_multiply(a, b));
+    const auto d  = boost::fixed_point::exact_subtract(-ab, ab);
+
+    BOOST_CHECK_EQUAL(ab, decltype(ab)(7.9375 * 3.96875));
+    BOOST_CHECK_EQUAL(s,  decltype(s) (7.9375 * 3.96875 * 2));
+    BOOST_CHECK_EQUAL(d,  decltype(d) (7.9375 * 3.96875 * -2));
+  }
+
+  {
+    const fixed_point_type_a a(-2.8125);
+    const fixed_point_type_b b(+1.03125);
+    const fixed_point_type_a c(+0.0625);
+    const fixed_point_type_b d(-3.96875);
+
+    const auto x = boost::fixed_point::exact_add(boost::fixed_point::exact_multiply(a, b),
+                                                 boost::fixed_point::exact_multiply(c, d));
+
+    BOOST_CHECK_EQUAL(x, decltype(x)((-2.8125 * 1.03125) + (0.0625 * -3.96875)));
+  }
+
+  {
+    const fixed_point_type_c a = fixed_point_type_c(1) / 3;
+    const fixed_point_type_c b = fixed_point_type_c(-1) / 7;
+
+    const auto ab = boost::fixed_point::exact_multiply(a, b);
+
+    static_assert(decltype(ab)::all_bits == 63, "Error: Wrong bit growth of multiply.");
+
+    BOOST_CHECK_EQUAL(ab.crepresentation(), std::int64_t(a.crepresentation()) * std::int64_t(b.crepresentation()));
+
+    // The exact product rounds back to the same value as the native product.
+    BOOST_CHECK_EQUAL(fixed_point_type_c(ab), a * b);
+  }
+}
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests mul and div of fixed_point negatable with compile-time integral constant operands.
+
+#include <cstdint>
+#include <type_traits>
+
+#define BOOST_TEST_MODULE test_negatable_basic_constant_operands
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType, typename IntegralType, const IntegralType N>
+  bool check_one(const NegatableType& x)
+  {
+    const std::integral_constant<IntegralType, N> n;
+
+    const bool div_is_ok = ((x / n) == (x / N));
+    const bool mul_is_ok = ((x * n) == (x * N)) && ((n * x) == (x * N));
+
+    return (div_is_ok && mul_is_ok);
+  }
+
+  template<typename NegatableType>
+  bool check_all(const NegatableType& x)
+  {
+    return (   check_one<NegatableType, unsigned,        1U>(x)
+            && check_one<NegatableType, unsigned,        2U>(x)
+            && check_one<NegatableType, unsigned,        3U>(x)
+            && check_one<NegatableType, unsigned,        7U>(x)
+            && check_one<NegatableType, unsigned,       10U>(x)
+            && check_one<NegatableType, unsigned,       12U>(x)
+            && check_one<NegatableType, unsigned,       16U>(x)
+            && check_one<NegatableType, unsigned,     1000U>(x)
+            && check_one<NegatableType, unsigned,   100003U>(x)
+            && check_one<NegatableType, int,            -2 >(x)
+            && check_one<NegatableType, int,            -5 >(x)
+            && check_one<NegatableType, std::uint8_t,    9U>(x)
+            && check_one<NegatableType, std::uint64_t, UINT64_C(0x100000000)>(x)
+            && check_one<NegatableType, std::uint64_t, UINT64_C(0x100000001)>(x));
+  }
+
+  template<typename NegatableType>
+  void check_exhaustive()
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    // The most negative representation is excluded. Its magnitude with the
+    // extra rounding bit does not fit in the unsigned small type.
+    const value_type lo = value_type(std::numeric_limits<NegatableType>::lowest().crepresentation() + 1);
+    const value_type hi = (std::numeric_limits<NegatableType>::max)().crepresentation();
+
+    std::uint_fast32_t error_count = 0U;
+
+    for(std::int_fast32_t i = std::int_fast32_t(lo); i <= std::int_fast32_t(hi); ++i)
+    {
+      if(check_all(NegatableType(nothing(), value_type(i))) == false)
+      {
+        ++error_count;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(error_count, 0U);
+  }
+
+  template<typename NegatableType>
+  void check_sampled()
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    std::uint_fast32_t error_count = 0U;
+
+    // Use a simple linear congruential generator to sample the representations.
+    std::uint32_t seed = UINT32_C(0x12345678);
+
+    for(std::uint_fast32_t i = 0U; i < UINT32_C(200000); ++i)
+    {
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const value_type n = value_type(value_type(seed) >> (NegatableType::all_bits < 32 ? (32 - NegatableType::all_bits) : 0));
+
+      if(check_all(NegatableType(nothing(), n)) == false)
+      {
+        ++error_count;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(error_count, 0U);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_basic_constant_operands)
+{
+  local::check_exhaustive<boost::fixed_point::negatable<2,  -5>>();
+  local::check_exhaustive<boost::fixed_point::negatable<2,  -5, boost::fixed_point::round::nearest_even>>();
+  local::check_exhaustive<boost::fixed_point::negatable<4, -11>>();
+  local::check_exhaustive<boost::fixed_point::negatable<4, -11, boost::fixed_point::round::nearest_even>>();
+  local::check_exhaustive<boost::fixed_point::negatable<4, -11, boost::fixed_point::round::classic>>();
+
+  local::check_sampled<boost::fixed_point::negatable<7, -24>>();
+  local::check_sampled<boost::fixed_point::negatable<7, -24, boost::fixed_point::round::nearest_even>>();
+  local::check_sampled<boost::fixed_point::negatable<10, -53>>();
+
+  {
+    typedef boost::fixed_point::negatable<7, -24> fixed_point_type;
+
+    const fixed_point_type x = fixed_point_type(12) / std::integral_constant<unsigned, 10U>();
+
+    BOOST_CHECK_EQUAL(x, fixed_point_type(12) / 10U);
+
+    const std::integral_constant<unsigned, 5U> five;
+
+    BOOST_CHECK_EQUAL(x * five, x * 5U);
+  }
+}
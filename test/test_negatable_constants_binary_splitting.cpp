@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for the wide constants of negatable obtained from tables and computed with binary splitting.
+
+#define BOOST_TEST_MODULE test_negatable_constants_binary_splitting
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  void test_constants()
+  {
+    typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<-FixedPointType::resolution + 64, boost::multiprecision::digit_base_2>,
+                                          boost::multiprecision::et_off> float_point_type;
+
+    typedef boost::fixed_point::negatable_constants<FixedPointType> constants_type;
+
+    const float_point_type scale = ldexp(float_point_type(1), -FixedPointType::resolution);
+
+    const FixedPointType values[12U] =
+    {
+      constants_type::pi(),
+      constants_type::pi_half(),
+      constants_type::e(),
+      constants_type::ln_two(),
+      constants_type::root_two(),
+      constants_type::ln_ten(),
+      constants_type::inv_ln_two(),
+      constants_type::inv_ln_ten(),
+      constants_type::two_over_pi(),
+      constants_type::pi_quarter(),
+      constants_type::inv_pi(),
+      constants_type::sqrt_pi()
+    };
+
+    const float_point_type references[12U] =
+    {
+      boost::math::constants::pi            <float_point_type>(),
+      boost::math::constants::half_pi       <float_point_type>(),
+      boost::math::constants::e             <float_point_type>(),
+      boost::math::constants::ln_two        <float_point_type>(),
+      boost::math::constants::root_two      <float_point_type>(),
+      boost::math::constants::ln_ten        <float_point_type>(),
+      1 / boost::math::constants::ln_two    <float_point_type>(),
+      1 / boost::math::constants::ln_ten    <float_point_type>(),
+      boost::math::constants::two_div_pi    <float_point_type>(),
+      boost::math::constants::pi            <float_point_type>() / 4,
+      boost::math::constants::one_div_pi    <float_point_type>(),
+      boost::math::constants::root_pi       <float_point_type>()
+    };
+
+    // The representations are rounded to nearest.
+    for(int i = 0; i < 12; ++i)
+    {
+      const float_point_type delta = fabs(float_point_type(values[i].crepresentation()) - (references[i] * scale));
+
+      BOOST_CHECK(delta <= float_point_type(0.5F));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_constants_binary_splitting)
+{
+  // The widest type is tested first. The constants of the narrower type
+  // beyond the tables are then derived by shifting.
+
+  local::test_constants<boost::fixed_point::negatable<8, -2000>>();
+  local::test_constants<boost::fixed_point::negatable<5, -1100>>();
+
+  // These constants are obtained from the tables.
+  local::test_constants<boost::fixed_point::negatable<2, -1020>>();
+  local::test_constants<boost::fixed_point::negatable<4,  -700>>();
+  local::test_constants<boost::fixed_point::negatable<2,  -253>>();
+  local::test_constants<boost::fixed_point::negatable<7,  -120>>();
+  local::test_constants<boost::fixed_point::negatable<3,   -64>>();
+}
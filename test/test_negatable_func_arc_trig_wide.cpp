@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for asin(fixed_point), acos(fixed_point) and atan(fixed_point) with argument halving for wide resolutions.
+
+#define BOOST_TEST_MODULE test_negatable_func_arc_trig_wide
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <cmath>
+#include <type_traits>
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  FixedPointType tolerance_maker(const int fuzzy_bits)
+  {
+    return ldexp(FixedPointType(1), FixedPointType::resolution + fuzzy_bits);
+  }
+
+  template<typename FixedPointType,
+           typename FloatPointType = typename FixedPointType::float_type>
+  void test_arc_trig(const int fuzzy_bits)
+  {
+    using std::asin;
+    using std::acos;
+    using std::atan;
+
+    for(int i = 1; i < 32; ++i)
+    {
+      const FixedPointType a(FixedPointType(i) / 32);
+      const FloatPointType b(FloatPointType(i) / 32);
+
+      BOOST_CHECK_CLOSE_FRACTION(asin(+a),    FixedPointType(asin(+b)),    tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(asin(-a),    FixedPointType(asin(-b)),    tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(acos(+a),    FixedPointType(acos(+b)),    tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(acos(-a),    FixedPointType(acos(-b)),    tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(atan(a * 3), FixedPointType(atan(b * 3)), tolerance_maker<FixedPointType>(fuzzy_bits));
+    }
+
+    // Check arguments close to 1, for which the square root
+    // of 1 - x must retain its relative precision. The small
+    // result of acos is checked in absolute terms.
+    for(int n = 4; n < FixedPointType::radix_split; n += 4)
+    {
+      const FixedPointType a(1 - ldexp(FixedPointType(1), -n));
+      const FloatPointType b(1 - ldexp(FloatPointType(1), -n));
+
+      BOOST_CHECK_CLOSE_FRACTION(asin(a), FixedPointType(asin(b)), tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_SMALL(FixedPointType(acos(a) - FixedPointType(acos(b))), tolerance_maker<FixedPointType>(fuzzy_bits));
+    }
+
+    // Check exact values.
+    BOOST_CHECK_EQUAL(asin(FixedPointType(0)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(acos(FixedPointType(1)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(atan(FixedPointType(0)), FixedPointType(0));
+  }
+
+  template<typename FixedPointType>
+  void test_atan_kernels(const int fuzzy_bits)
+  {
+    // The argument halving must be selected for this type.
+    BOOST_STATIC_ASSERT(boost::fixed_point::detail::wide_atan_tier<FixedPointType::radix_split>::use_argument_halving::value);
+
+    // Compare the argument halving with the Newton iteration on sin and cos.
+    for(int i = 1; i < 8; ++i)
+    {
+      const FixedPointType x = FixedPointType(i) / 8;
+
+      BOOST_CHECK_CLOSE_FRACTION(boost::fixed_point::detail::atan_wide_series(x, std::true_type()),
+                                 boost::fixed_point::detail::atan_wide_series(x, std::false_type()),
+                                 tolerance_maker<FixedPointType>(fuzzy_bits));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_arc_trig_wide)
+{
+  // Test asin(), acos() and atan() for negatable in a minimax tier and beyond the minimax tiers.
+
+  { typedef boost::fixed_point::negatable<15,  -48>                                         fixed_point_type; local::test_arc_trig<fixed_point_type>(4); }
+  { typedef boost::fixed_point::negatable< 8, -300, boost::fixed_point::round::nearest_even> fixed_point_type; local::test_arc_trig<fixed_point_type>(4); local::test_atan_kernels<fixed_point_type>(12); }
+  { typedef boost::fixed_point::negatable< 7, -600>                                         fixed_point_type; local::test_arc_trig<fixed_point_type>(4); }
+}
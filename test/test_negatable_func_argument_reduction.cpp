@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the reduction of large trigonometric arguments of (fixed_point) modulo pi/2.
+
+#include <cmath>
+#include <cstdint>
+
+#define BOOST_TEST_MODULE test_negatable_func_argument_reduction
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  long double to_long_double(const NegatableType& x)
+  {
+    return std::ldexp(static_cast<long double>(x.crepresentation()), NegatableType::resolution);
+  }
+
+  template<typename NegatableType>
+  void test_argument_reduction(const int fuzzy_bits)
+  {
+    const long double tol = std::ldexp(1.0L, NegatableType::resolution + fuzzy_bits);
+
+    // Use a simple linear congruential generator for arguments
+    // spread over the whole range of the fixed-point type.
+    std::uint32_t seed = UINT32_C(12345);
+
+    for(int i = 0; i < 1000; ++i)
+    {
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const int exponent = int(seed % std::uint32_t(NegatableType::range - 2)) + 2;
+
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const NegatableType x = ldexp(NegatableType(1) + (NegatableType(float(seed >> 8) / 16777216.0F) / 2), exponent);
+
+      const long double x_ld = to_long_double(x);
+
+      NegatableType s;
+      NegatableType c;
+
+      boost::fixed_point::sincos(x, &s, &c);
+
+      BOOST_CHECK(std::fabs(to_long_double(sin(x)) - std::sin(x_ld)) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(cos(x)) - std::cos(x_ld)) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(s)      - std::sin(x_ld)) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(c)      - std::cos(x_ld)) <= tol);
+
+      BOOST_CHECK(std::fabs(to_long_double(sin(-x)) + std::sin(x_ld)) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(cos(-x)) - std::cos(x_ld)) <= tol);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_argument_reduction)
+{
+  local::test_argument_reduction<boost::fixed_point::negatable<15, -16>>(3);
+  local::test_argument_reduction<boost::fixed_point::negatable<40, -20>>(3);
+  local::test_argument_reduction<boost::fixed_point::negatable<10, -53>>(3);
+}
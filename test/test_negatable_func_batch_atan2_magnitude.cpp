@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the batch atan2 and magnitude functions of IQ samples of (fixed_point) against long double.
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_negatable_func_batch_atan2_magnitude
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  bool is_close(const NegatableType& x, const long double reference, const int fuzzy_bits)
+  {
+    using std::fabs;
+    using std::ldexp;
+
+    return (fabs(static_cast<long double>(x) - reference) <= ldexp(1.0L, NegatableType::resolution + fuzzy_bits));
+  }
+
+  template<typename NegatableType>
+  void test_batch_atan2_magnitude(const int range)
+  {
+    // Use samples of various lengths and directions, including the axes,
+    // the diagonals, short vectors and an odd number of elements
+    // in order to exercise the partial block.
+    std::vector<NegatableType> x;
+    std::vector<NegatableType> y;
+
+    for(int n = 0; n < NegatableType::radix_split; n += 3)
+    {
+      for(int i = -8; i <= 8; ++i)
+      {
+        for(int j = -8; j <= 8; ++j)
+        {
+          x.push_back(ldexp(NegatableType(range * i) / 8, -n));
+          y.push_back(ldexp(NegatableType(range * j) / 8, -n) + ldexp(NegatableType(i), -n - 4));
+        }
+      }
+    }
+
+    x.push_back(NegatableType(0));
+    y.push_back(NegatableType(0));
+
+    x.push_back((std::numeric_limits<NegatableType>::lowest)() / 2);
+    y.push_back((std::numeric_limits<NegatableType>::lowest)() / 2);
+
+    x.push_back((std::numeric_limits<NegatableType>::min)());
+    y.push_back((std::numeric_limits<NegatableType>::min)() * 3);
+
+    std::vector<NegatableType> a(x.size());
+    std::vector<NegatableType> m(x.size());
+
+    boost::fixed_point::batch::atan2    (y.data(), x.data(), a.data(), x.size());
+    boost::fixed_point::batch::magnitude(x.data(), y.data(), m.data(), x.size());
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      const long double u = static_cast<long double>(x[i]);
+      const long double v = static_cast<long double>(y[i]);
+
+      BOOST_CHECK(is_close(a[i], std::atan2(v, u), 1));
+      BOOST_CHECK(is_close(m[i], std::hypot(u, v), 1));
+    }
+
+    // Check the special cases.
+    BOOST_CHECK_EQUAL(a[x.size() - 3U], NegatableType(0));
+    BOOST_CHECK_EQUAL(m[x.size() - 3U], NegatableType(0));
+
+    // Check in-place evaluation.
+    std::vector<NegatableType> z(x);
+
+    boost::fixed_point::batch::magnitude(z.data(), y.data(), z.data(), z.size());
+
+    BOOST_CHECK(z == m);
+
+    z = y;
+
+    boost::fixed_point::batch::atan2(z.data(), x.data(), z.data(), z.size());
+
+    BOOST_CHECK(z == a);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_batch_atan2_magnitude)
+{
+  local::test_batch_atan2_magnitude<boost::fixed_point::negatable< 4, -11>>(    8);
+  local::test_batch_atan2_magnitude<boost::fixed_point::negatable< 7, -24>>(   64);
+  local::test_batch_atan2_magnitude<boost::fixed_point::negatable<15, -16>>(16384);
+  local::test_batch_atan2_magnitude<boost::fixed_point::negatable< 2, -29, boost::fixed_point::round::nearest_even>>(2);
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the batch exponential and logarithm functions of (fixed_point) against the scalar functions.
+
+#include <cstddef>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_negatable_func_batch_exp_log
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  void test_batch_exp_log(const int range_in_tenths)
+  {
+    // Use an odd number of elements in order to exercise the remainder loop.
+    std::vector<NegatableType> x;
+    std::vector<NegatableType> x_pos;
+
+    for(int i = -range_in_tenths; i <= range_in_tenths; ++i)
+    {
+      x.push_back(NegatableType(i) / 10);
+
+      if(i > 0)
+      {
+        x_pos.push_back(NegatableType(i) / 10);
+      }
+    }
+
+    std::vector<NegatableType> e (x.size());
+    std::vector<NegatableType> e2(x.size());
+    std::vector<NegatableType> l (x_pos.size());
+    std::vector<NegatableType> l2(x_pos.size());
+
+    boost::fixed_point::batch::exp (x.data(),     e.data(),  x.size());
+    boost::fixed_point::batch::exp2(x.data(),     e2.data(), x.size());
+    boost::fixed_point::batch::log (x_pos.data(), l.data(),  x_pos.size());
+    boost::fixed_point::batch::log2(x_pos.data(), l2.data(), x_pos.size());
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL(e [i].crepresentation(), exp (x[i]).crepresentation());
+      BOOST_CHECK_EQUAL(e2[i].crepresentation(), exp2(x[i]).crepresentation());
+    }
+
+    for(std::size_t i = 0U; i < x_pos.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL(l [i].crepresentation(), log (x_pos[i]).crepresentation());
+      BOOST_CHECK_EQUAL(l2[i].crepresentation(), log2(x_pos[i]).crepresentation());
+    }
+
+    // Check in-place evaluation.
+    std::vector<NegatableType> y(x_pos);
+
+    boost::fixed_point::batch::log(y.data(), y.data(), y.size());
+
+    BOOST_CHECK(y == l);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_batch_exp_log)
+{
+  local::test_batch_exp_log<boost::fixed_point::negatable< 4, -11>>(25);
+  local::test_batch_exp_log<boost::fixed_point::negatable< 7, -24>>(45);
+  local::test_batch_exp_log<boost::fixed_point::negatable<10, -53>>(30);
+}
@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the batch sine and cosine functions of (fixed_point) against the scalar functions.
+
+#include <cstddef>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_negatable_func_batch_sin_cos
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  void test_batch_sin_cos(const int range_in_tenths)
+  {
+    // Use an odd number of elements in order to exercise the remainder loop.
+    std::vector<NegatableType> x;
+
+    for(int i = -range_in_tenths; i <= range_in_tenths; ++i)
+    {
+      x.push_back(NegatableType(i) / 10);
+    }
+
+    std::vector<NegatableType> s(x.size());
+    std::vector<NegatableType> c(x.size());
+
+    boost::fixed_point::batch::sin(x.data(), s.data(), x.size());
+    boost::fixed_point::batch::cos(x.data(), c.data(), x.size());
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL(s[i].crepresentation(), sin(x[i]).crepresentation());
+      BOOST_CHECK_EQUAL(c[i].crepresentation(), cos(x[i]).crepresentation());
+    }
+
+    // Check in-place evaluation.
+    std::vector<NegatableType> y(x);
+
+    boost::fixed_point::batch::sin(y.data(), y.data(), y.size());
+
+    BOOST_CHECK(y == s);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_batch_sin_cos)
+{
+  local::test_batch_sin_cos<boost::fixed_point::negatable< 4, -11>>(70);
+  local::test_batch_sin_cos<boost::fixed_point::negatable< 7, -24>>(70);
+  local::test_batch_sin_cos<boost::fixed_point::negatable<10, -53>>(30);
+}
@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the batch square root and reciprocal square root functions of (fixed_point).
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_negatable_func_batch_sqrt
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  void test_batch_sqrt(const int count, const int fuzzy_bits)
+  {
+    typedef typename NegatableType::float_type float_point_type;
+
+    // Use an odd number of elements in order to exercise the remainder loop.
+    std::vector<NegatableType> x;
+
+    for(int i = 1; i <= count; ++i)
+    {
+      x.push_back(NegatableType(float_point_type(i) / 8));
+    }
+
+    std::vector<NegatableType> s(x.size());
+    std::vector<NegatableType> r(x.size());
+
+    boost::fixed_point::batch::sqrt (x.data(), s.data(), x.size());
+    boost::fixed_point::batch::rsqrt(x.data(), r.data(), x.size());
+
+    const NegatableType tol = ldexp(NegatableType(1), NegatableType::resolution + fuzzy_bits);
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL(s[i].crepresentation(), sqrt (x[i]).crepresentation());
+      BOOST_CHECK_EQUAL(r[i].crepresentation(), rsqrt(x[i]).crepresentation());
+
+      using std::sqrt;
+      const float_point_type y = 1 / sqrt(float_point_type(int(i + 1U)) / 8);
+
+      BOOST_CHECK_CLOSE_FRACTION(r[i], NegatableType(y), tol);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_batch_sqrt)
+{
+  local::test_batch_sqrt<boost::fixed_point::negatable< 4, -11>>( 99, 6);
+  local::test_batch_sqrt<boost::fixed_point::negatable< 7, -24>>(799, 8);
+  local::test_batch_sqrt<boost::fixed_point::negatable<10, -53>>( 99, 8);
+}
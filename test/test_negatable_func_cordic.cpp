@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the CORDIC trigonometric and hyperbolic functions of (fixed_point) against long double.
+
+#include <algorithm>
+#include <cmath>
+
+#define BOOST_TEST_MODULE test_negatable_func_cordic
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  bool is_close(const NegatableType& x, const long double reference, const int fuzzy_bits)
+  {
+    using std::fabs;
+    using std::ldexp;
+
+    // Use an absolute tolerance, scaled for results larger than one.
+    const long double tolerance = ldexp(1.0L, NegatableType::resolution + fuzzy_bits) * (std::max)(1.0L, fabs(reference));
+
+    return (fabs(static_cast<long double>(x) - reference) <= tolerance);
+  }
+
+  template<typename NegatableType>
+  void test_cordic(const int range_in_tenths, const int hyperbolic_range_in_tenths)
+  {
+    for(int i = -range_in_tenths; i <= range_in_tenths; ++i)
+    {
+      const NegatableType x = NegatableType(static_cast<long double>(i) / 10);
+      const long double   u = static_cast<long double>(x);
+
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::sin (x), std::sin (u), 2));
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::cos (x), std::cos (u), 2));
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::atan(x), std::atan(u), 2));
+
+      const NegatableType y = NegatableType(static_cast<long double>(range_in_tenths - i) / 20);
+      const long double   v = static_cast<long double>(y);
+
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::atan2(y, x), std::atan2(v, u), 2));
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::atan2(x, y), std::atan2(u, v), 2));
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::hypot(x / 2, y / 2), std::hypot(u / 2, v / 2), 2));
+    }
+
+    for(int i = -hyperbolic_range_in_tenths; i <= hyperbolic_range_in_tenths; ++i)
+    {
+      const NegatableType x = NegatableType(static_cast<long double>(i) / 10);
+      const long double   u = static_cast<long double>(x);
+
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::sinh(x), std::sinh(u), 3));
+      BOOST_CHECK(is_close(boost::fixed_point::cordic::cosh(x), std::cosh(u), 3));
+    }
+
+    // Check the special cases of atan2.
+    BOOST_CHECK_EQUAL(boost::fixed_point::cordic::atan2(NegatableType(0), NegatableType(0)), NegatableType(0));
+    BOOST_CHECK(is_close(boost::fixed_point::cordic::atan2(NegatableType( 0), NegatableType(-1)),  std::atan2( 0.0L, -1.0L), 2));
+    BOOST_CHECK(is_close(boost::fixed_point::cordic::atan2(NegatableType(-1), NegatableType( 0)),  std::atan2(-1.0L,  0.0L), 2));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_cordic)
+{
+  local::test_cordic<boost::fixed_point::negatable< 4, -11>>(150, 34);
+  local::test_cordic<boost::fixed_point::negatable< 7, -24>>(700, 55);
+  local::test_cordic<boost::fixed_point::negatable<10, -53>>(700, 76);
+  local::test_cordic<boost::fixed_point::negatable< 2, -61>>( 35,  18);
+}
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for the base-2 exponential function exp2 of (fixed_point).
+
+#include <cmath>
+
+#define BOOST_TEST_MODULE test_negatable_func_exp2
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  void test_exp2(const int fuzzy_bits)
+  {
+    typedef typename NegatableType::float_type float_point_type;
+
+    const NegatableType tol = ldexp(NegatableType(1), NegatableType::resolution + fuzzy_bits);
+
+    for(int i = -30; i <= 30; ++i)
+    {
+      const NegatableType x = exp2(NegatableType(i) / 10);
+
+      using std::exp2;
+      using std::pow;
+      const float_point_type y = pow(float_point_type(2), float_point_type(i) / 10);
+
+      BOOST_CHECK_CLOSE_FRACTION(x, NegatableType(y), tol);
+    }
+
+    // Integral arguments are exact.
+    BOOST_CHECK_EQUAL(exp2(NegatableType( 0)), NegatableType(1));
+    BOOST_CHECK_EQUAL(exp2(NegatableType( 3)), NegatableType(8));
+    BOOST_CHECK_EQUAL(exp2(NegatableType(-2)), NegatableType(1) / 4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_exp2)
+{
+  local::test_exp2<boost::fixed_point::negatable< 5, -10>>(4);
+  local::test_exp2<boost::fixed_point::negatable< 7, -24>>(6);
+  local::test_exp2<boost::fixed_point::negatable<10, -53>>(6);
+}
@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for exp(fixed_point) and log(fixed_point) with binary splitting and AGM for very wide resolutions.
+
+#define BOOST_TEST_MODULE test_negatable_func_exp_log_wide
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <cmath>
+#include <type_traits>
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  FixedPointType tolerance_maker(const int fuzzy_bits)
+  {
+    return ldexp(FixedPointType(1), FixedPointType::resolution + fuzzy_bits);
+  }
+
+  template<typename FixedPointType,
+           typename FloatPointType = typename FixedPointType::float_type>
+  void test_exp_log(const int fuzzy_bits)
+  {
+    // The wide algorithms must be selected for this type.
+    BOOST_STATIC_ASSERT(boost::fixed_point::detail::wide_exp_log_tier<FixedPointType::radix_split>::use_binary_splitting::value);
+    BOOST_STATIC_ASSERT(boost::fixed_point::detail::wide_exp_log_tier<FixedPointType::radix_split>::use_agm::value);
+
+    using std::exp;
+    using std::log;
+
+    for(int i = 1; i < 24; ++i)
+    {
+      const FixedPointType a(FixedPointType(i) / 7);
+      const FloatPointType b(FloatPointType(i) / 7);
+
+      BOOST_CHECK_CLOSE_FRACTION(exp(+a), FixedPointType(exp(+b)), tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(exp(-a), FixedPointType(exp(-b)), tolerance_maker<FixedPointType>(fuzzy_bits));
+      BOOST_CHECK_CLOSE_FRACTION(log(a),  FixedPointType(log(b)),  tolerance_maker<FixedPointType>(fuzzy_bits));
+    }
+
+    // Compare the kernels with the series and the Newton iteration,
+    // which are used for smaller resolutions.
+    for(int i = 1; i < 8; ++i)
+    {
+      const FixedPointType r = (FixedPointType(i) / 23) * ((i % 2) ? 1 : -1);
+      const FixedPointType x = 1 + (FixedPointType(i) / 8);
+
+      BOOST_CHECK_CLOSE_FRACTION(boost::fixed_point::detail::exp_wide_series(r, std::true_type()),
+                                 boost::fixed_point::detail::exp_wide_series(r, std::false_type()),
+                                 tolerance_maker<FixedPointType>(fuzzy_bits));
+
+      BOOST_CHECK_CLOSE_FRACTION(boost::fixed_point::detail::log_wide_iteration(x, std::true_type()),
+                                 boost::fixed_point::detail::log_wide_iteration(x, std::false_type()),
+                                 tolerance_maker<FixedPointType>(fuzzy_bits));
+    }
+
+    // Check exact values.
+    BOOST_CHECK_EQUAL(exp(FixedPointType(0)), FixedPointType(1));
+    BOOST_CHECK_EQUAL(log(FixedPointType(1)), FixedPointType(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_exp_log_wide)
+{
+  // Test exp() and log() for negatable above the thresholds of binary splitting and AGM.
+
+  { typedef boost::fixed_point::negatable<8, -740, boost::fixed_point::round::nearest_even> fixed_point_type; local::test_exp_log<fixed_point_type>(12); }
+  { typedef boost::fixed_point::negatable<7, -760, boost::fixed_point::round::fastest>      fixed_point_type; local::test_exp_log<fixed_point_type>(12); }
+}
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for expm1(fixed_point), log1p(fixed_point) and the hyperbolic functions built on expm1.
+
+#define BOOST_TEST_MODULE test_negatable_func_expm1_log1p
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <cmath>
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  FixedPointType tolerance_maker(const int fuzzy_bits)
+  {
+    return ldexp(FixedPointType(1), FixedPointType::resolution + fuzzy_bits);
+  }
+
+  template<typename FixedPointType,
+           typename FloatPointType = typename FixedPointType::float_type>
+  void test_expm1_log1p(const int fuzzy_bits)
+  {
+    using std::expm1;
+    using std::log1p;
+    using std::sinh;
+    using std::cosh;
+    using std::tanh;
+
+    const FixedPointType tol = tolerance_maker<FixedPointType>(fuzzy_bits);
+
+    // For |x| < 1, the errors are checked in absolute terms.
+    // These arguments span the kernels and the argument reductions.
+    for(int i = 1; i < 32; ++i)
+    {
+      const FixedPointType a(FixedPointType(i) / 32);
+      const FloatPointType b(FloatPointType(i) / 32);
+
+      BOOST_CHECK_SMALL(FixedPointType(expm1(+a) - FixedPointType(expm1(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(expm1(-a) - FixedPointType(expm1(-b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(log1p(+a) - FixedPointType(log1p(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(log1p(-a / 2) - FixedPointType(log1p(-b / 2))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(sinh(+a) - FixedPointType(sinh(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(sinh(-a) - FixedPointType(sinh(-b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(cosh(-a) - FixedPointType(cosh(-b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(tanh(+a) - FixedPointType(tanh(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(tanh(-a) - FixedPointType(tanh(-b))), tol);
+    }
+
+    // For 1 < |x| <= 3, the reduction amplifies the error of the
+    // kernel by 2^n, and the results are checked in relative terms.
+    for(int i = 1; i <= 16; ++i)
+    {
+      const FixedPointType a(1 + (FixedPointType(i) / 8));
+      const FloatPointType b(1 + (FloatPointType(i) / 8));
+
+      BOOST_CHECK_CLOSE_FRACTION(expm1(+a), FixedPointType(expm1(+b)), tol);
+      BOOST_CHECK_CLOSE_FRACTION(expm1(-a), FixedPointType(expm1(-b)), tol);
+      BOOST_CHECK_CLOSE_FRACTION(sinh(-a),  FixedPointType(sinh(-b)),  tol);
+      BOOST_CHECK_CLOSE_FRACTION(cosh(-a),  FixedPointType(cosh(-b)),  tol);
+      BOOST_CHECK_SMALL(FixedPointType(log1p(a * 4) - FixedPointType(log1p(b * 4))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(tanh(-a) - FixedPointType(tanh(-b))), tol);
+    }
+
+    // Check small arguments, for which 1 + x and exp(x) - 1 lose their precision.
+    for(int n = 2; n < FixedPointType::radix_split; n += 2)
+    {
+      const FixedPointType a(ldexp(FixedPointType(1), -n));
+      const FloatPointType b(ldexp(FloatPointType(1), -n));
+
+      BOOST_CHECK_SMALL(FixedPointType(expm1(-a) - FixedPointType(expm1(-b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(log1p(+a) - FixedPointType(log1p(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(sinh(+a) - FixedPointType(sinh(+b))), tol);
+    }
+
+    // Check arguments close to -1 for log1p and large negative arguments for expm1.
+    BOOST_CHECK_SMALL(FixedPointType(log1p(FixedPointType(-7) / 8) - FixedPointType(log1p(FloatPointType(-7) / 8))), tol);
+    BOOST_CHECK_SMALL(FixedPointType(expm1(FixedPointType(-30)) - FixedPointType(expm1(FloatPointType(-30)))), tol);
+
+    // Check sinh_cosh against sinh and cosh.
+    FixedPointType s;
+    FixedPointType c;
+
+    sinh_cosh(FixedPointType(-3) / 4, &s, &c);
+
+    BOOST_CHECK_EQUAL(s, sinh(FixedPointType(-3) / 4));
+    BOOST_CHECK_EQUAL(c, cosh(FixedPointType(-3) / 4));
+
+    // Check exact values.
+    BOOST_CHECK_EQUAL(expm1(FixedPointType(0)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(log1p(FixedPointType(0)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(sinh (FixedPointType(0)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(cosh (FixedPointType(0)), FixedPointType(1));
+    BOOST_CHECK_EQUAL(tanh (FixedPointType(0)), FixedPointType(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_expm1_log1p)
+{
+  // Test expm1(), log1p(), sinh(), cosh() and tanh() for negatable in the polynomial tiers and the wide tiers.
+
+  { typedef boost::fixed_point::negatable< 5,  -10>                                         fixed_point_type; local::test_expm1_log1p<fixed_point_type>(4); }
+  { typedef boost::fixed_point::negatable< 7,  -24>                                         fixed_point_type; local::test_expm1_log1p<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<15,  -48>                                         fixed_point_type; local::test_expm1_log1p<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<10, -117, boost::fixed_point::round::nearest_even> fixed_point_type; local::test_expm1_log1p<fixed_point_type>(5); }
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for asinh(fixed_point), acosh(fixed_point) and atanh(fixed_point) in all resolution tiers.
+
+#define BOOST_TEST_MODULE test_negatable_func_hyperbolic_arc_tiered
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <cmath>
+#include <limits>
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  FixedPointType tolerance_maker(const int fuzzy_bits)
+  {
+    return ldexp(FixedPointType(1), FixedPointType::resolution + fuzzy_bits);
+  }
+
+  template<typename FixedPointType,
+           typename FloatPointType = typename FixedPointType::float_type>
+  void test_hyperbolic_arc(const int fuzzy_bits)
+  {
+    using std::asinh;
+    using std::acosh;
+    using std::atanh;
+
+    // The errors are checked in absolute terms, since the
+    // polynomials and the logarithm are accurate to a few units
+    // of the resolution rather than relative to the result.
+    const FixedPointType tol = tolerance_maker<FixedPointType>(fuzzy_bits);
+
+    for(int i = 1; i < 32; ++i)
+    {
+      const FixedPointType a(FixedPointType(i) / 32);
+      const FloatPointType b(FloatPointType(i) / 32);
+
+      // The arguments of asinh and acosh span the polynomial and the logarithm.
+      BOOST_CHECK_SMALL(FixedPointType(asinh(+a * 3) - FixedPointType(asinh(+b * 3))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(asinh(-a * 3) - FixedPointType(asinh(-b * 3))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(acosh(1 + a * 3) - FixedPointType(acosh(1 + b * 3))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(atanh(+a) - FixedPointType(atanh(+b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(atanh(-a) - FixedPointType(atanh(-b))), tol);
+    }
+
+    // Check arguments close to 1, for which acosh must retain the
+    // precision of x - 1 and atanh must not overflow.
+    for(int n = 2; n < FixedPointType::radix_split; n += 2)
+    {
+      const FixedPointType a(ldexp(FixedPointType(1), -n));
+      const FloatPointType b(ldexp(FloatPointType(1), -n));
+
+      BOOST_CHECK_SMALL(FixedPointType(acosh(1 + a) - FixedPointType(acosh(1 + b))), tol);
+      BOOST_CHECK_SMALL(FixedPointType(atanh(1 - a) - FixedPointType(atanh(1 - b))), tol);
+    }
+
+    // Check the largest argument, for which x^2 exceeds the range.
+    const FixedPointType x_max = (std::numeric_limits<FixedPointType>::max)();
+    const FloatPointType y_max = ldexp(FloatPointType(1), FixedPointType::range) - ldexp(FloatPointType(1), FixedPointType::resolution);
+
+    BOOST_CHECK_SMALL(FixedPointType(asinh(x_max) - FixedPointType(asinh(y_max))), tol);
+    BOOST_CHECK_SMALL(FixedPointType(acosh(x_max) - FixedPointType(acosh(y_max))), tol);
+
+    // Check exact values.
+    BOOST_CHECK_EQUAL(asinh(FixedPointType(0)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(acosh(FixedPointType(1)), FixedPointType(0));
+    BOOST_CHECK_EQUAL(atanh(FixedPointType(0)), FixedPointType(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_hyperbolic_arc_tiered)
+{
+  // Test asinh(), acosh() and atanh() for negatable in the polynomial tiers and the wide tiers.
+
+  { typedef boost::fixed_point::negatable< 5,  -10>                                         fixed_point_type; local::test_hyperbolic_arc<fixed_point_type>(4); }
+  { typedef boost::fixed_point::negatable< 7,  -24>                                         fixed_point_type; local::test_hyperbolic_arc<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<15,  -48>                                         fixed_point_type; local::test_hyperbolic_arc<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<10, -117, boost::fixed_point::round::nearest_even> fixed_point_type; local::test_hyperbolic_arc<fixed_point_type>(5); }
+}
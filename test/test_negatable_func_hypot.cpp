@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the hypotenuse hypot(fixed_point) against the exact integer square root.
+
+#include <cstdint>
+#include <limits>
+
+#define BOOST_TEST_MODULE test_negatable_func_hypot
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  typedef boost::multiprecision::cpp_int integer_type;
+
+  // Check the representation of hypot(x, y) against the exact square root R
+  // of the sum of the squares of the representations, with R^2 <= S < (R + 1)^2.
+  // When rounding to nearest, R is incremented if S - R^2 exceeds R.
+  // Results beyond the range saturate.
+  template<typename NegatableType>
+  bool hypot_is_exact(const NegatableType& x, const NegatableType& y, const bool round_to_nearest)
+  {
+    const integer_type a(x.crepresentation());
+    const integer_type b(y.crepresentation());
+    const integer_type s((a * a) + (b * b));
+
+    integer_type r = sqrt(s);
+
+    if(round_to_nearest && ((s - (r * r)) > r))
+    {
+      ++r;
+    }
+
+    const integer_type r_max((std::numeric_limits<NegatableType>::max)().crepresentation());
+
+    if(r > r_max)
+    {
+      r = r_max;
+    }
+
+    return (integer_type(boost::fixed_point::hypot(x, y).crepresentation()) == r);
+  }
+
+  template<typename NegatableType>
+  void test_hypot_exhaustive(const bool round_to_nearest)
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    const value_type x_max = (std::numeric_limits<NegatableType>::max)().crepresentation();
+
+    for(int i = -int(x_max) - 1; i <= int(x_max); ++i)
+    {
+      for(int j = -int(x_max) - 1; j <= int(x_max); ++j)
+      {
+        BOOST_CHECK(hypot_is_exact(NegatableType(nothing(), value_type(i)), NegatableType(nothing(), value_type(j)), round_to_nearest));
+      }
+    }
+  }
+
+  template<typename NegatableType>
+  void test_hypot_random(const bool round_to_nearest)
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    BOOST_CONSTEXPR_OR_CONST int digits = std::numeric_limits<typename NegatableType::unsigned_small_type>::digits;
+
+    // Use a simple linear congruential generator for arguments
+    // spread over the whole range of the fixed-point type.
+    std::uint64_t seed = UINT64_C(12345);
+
+    for(int i = 0; i < 10000; ++i)
+    {
+      seed = (seed * UINT64_C(6364136223846793005)) + UINT64_C(1442695040888963407);
+      const std::uint64_t u = seed;
+      seed = (seed * UINT64_C(6364136223846793005)) + UINT64_C(1442695040888963407);
+      const std::uint64_t v = seed;
+
+      // Use arguments of similar and of very different magnitude.
+      const value_type x = value_type(value_type(u >> (64 - (digits - 1))) >> ((u >> 8) % unsigned(digits - 1)));
+      const value_type y = value_type(value_type(v >> (64 - (digits - 1))) >> ((v >> 8) % unsigned(digits - 1)));
+
+      BOOST_CHECK(hypot_is_exact(NegatableType(nothing(), x), NegatableType(nothing(), y), round_to_nearest));
+      BOOST_CHECK(hypot_is_exact(NegatableType(nothing(), value_type(-x)), NegatableType(nothing(), y), round_to_nearest));
+      BOOST_CHECK(hypot_is_exact(NegatableType(nothing(), x), NegatableType(nothing(), value_type(-y)), round_to_nearest));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_hypot)
+{
+  using boost::fixed_point::negatable;
+  using boost::fixed_point::round::fastest;
+  using boost::fixed_point::round::nearest_even;
+  using boost::fixed_point::round::classic;
+
+  local::test_hypot_exhaustive<negatable< 3,  -4, nearest_even>>(true);
+  local::test_hypot_exhaustive<negatable< 3,  -4, fastest>>     (false);
+  local::test_hypot_exhaustive<negatable< 0,  -7, classic>>     (true);
+
+  local::test_hypot_random<negatable< 4, -11, fastest>>     (false);
+  local::test_hypot_random<negatable< 4, -11, nearest_even>>(true);
+  local::test_hypot_random<negatable< 7, -24, fastest>>     (false);
+  local::test_hypot_random<negatable< 7, -24, nearest_even>>(true);
+  local::test_hypot_random<negatable<15, -16, classic>>     (true);
+  local::test_hypot_random<negatable<15, -48, fastest>>     (false);
+  local::test_hypot_random<negatable<10, -53, nearest_even>>(true);
+
+  // Exact values, which overflowed in the squares of x and y.
+  typedef negatable<4, -11> fixed_point_type;
+
+  BOOST_CHECK(boost::fixed_point::hypot(fixed_point_type(3),  fixed_point_type(4))  == fixed_point_type(5));
+  BOOST_CHECK(boost::fixed_point::hypot(fixed_point_type(-6), fixed_point_type(8))  == fixed_point_type(10));
+  BOOST_CHECK(boost::fixed_point::hypot(fixed_point_type(-9), fixed_point_type(0))  == fixed_point_type(9));
+  BOOST_CHECK(boost::fixed_point::hypot(fixed_point_type(0),  fixed_point_type(0))  == fixed_point_type(0));
+  BOOST_CHECK(boost::fixed_point::hypot(fixed_point_type(12), fixed_point_type(12)) == (std::numeric_limits<fixed_point_type>::max)());
+  BOOST_CHECK(boost::fixed_point::hypot((std::numeric_limits<fixed_point_type>::lowest)(),
+                                        (std::numeric_limits<fixed_point_type>::lowest)()) == (std::numeric_limits<fixed_point_type>::max)());
+}
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests for log2(fixed_point) and pow(fixed_point), and for exp and log built on the base-2 kernels.
+
+#define BOOST_TEST_MODULE test_negatable_func_log2_pow
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <cmath>
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename FixedPointType>
+  FixedPointType tolerance_maker(const int fuzzy_bits)
+  {
+    return ldexp(FixedPointType(1), FixedPointType::resolution + fuzzy_bits);
+  }
+
+  template<typename FixedPointType,
+           typename FloatPointType = typename FixedPointType::float_type>
+  void test_log2_pow(const int fuzzy_bits)
+  {
+    using std::exp;
+    using std::log;
+    using std::pow;
+    using std::sqrt;
+
+    const FixedPointType tol = tolerance_maker<FixedPointType>(fuzzy_bits);
+
+    const FloatPointType ln_two = log(FloatPointType(2));
+
+    for(int i = 1; i < 32; ++i)
+    {
+      const FixedPointType a(FixedPointType(i) / 8);
+      const FloatPointType b(FloatPointType(i) / 8);
+
+      BOOST_CHECK_SMALL(FixedPointType(log2(a) - FixedPointType(log(b) / ln_two)), tol);
+      BOOST_CHECK_CLOSE_FRACTION(pow(a, FixedPointType(3) / 4), FixedPointType(pow(b, FloatPointType(3) / 4)), tol);
+      BOOST_CHECK_CLOSE_FRACTION(pow(a, FixedPointType(-5) / 4), FixedPointType(pow(b, FloatPointType(-5) / 4)), tol);
+    }
+
+    // Check small arguments of log and log2, which do not overflow, and negative
+    // arguments of exp down to the resolution of the type. The error of log grows
+    // with the multiple n * log(2) of the rounded constant log(2).
+    for(int n = 1; n < FixedPointType::radix_split; ++n)
+    {
+      const FixedPointType a(ldexp(FixedPointType(3), -n - 1));
+      const FloatPointType b(ldexp(FloatPointType(3), -n - 1));
+
+      BOOST_CHECK_SMALL(FixedPointType(log2(a) - FixedPointType(log(b) / ln_two)), tol);
+      BOOST_CHECK_SMALL(FixedPointType(log (a) - FixedPointType(log(b))),          tol * (n + 2));
+
+      if(FloatPointType(n) < (FloatPointType(FixedPointType::radix_split) * ln_two))
+      {
+        BOOST_CHECK_SMALL(FixedPointType(exp(-FixedPointType(n)) - FixedPointType(exp(-FloatPointType(n)))), tol);
+      }
+    }
+
+    // The exponent 1/2 is the square root.
+    BOOST_CHECK_EQUAL(pow(FixedPointType(3), ldexp(FixedPointType(1), -1)), sqrt(FixedPointType(3)));
+
+    // Integral exponents use binary powers, also for negative exponents.
+    BOOST_CHECK_EQUAL(pow(FixedPointType(3) / 2, FixedPointType( 3)), pow(FixedPointType(3) / 2,  3));
+    BOOST_CHECK_EQUAL(pow(FixedPointType(2),     FixedPointType(-3)), FixedPointType(1) / 8);
+    BOOST_CHECK_EQUAL(pow(FixedPointType(-2),    FixedPointType( 3)), FixedPointType(-8));
+
+    // For a large base, x^n of a negative exponent is not representable, but its reciprocal is.
+    const FixedPointType x_big = ldexp(FixedPointType(1), FixedPointType::range - 1);
+
+    BOOST_CHECK_EQUAL(pow(x_big, -2), ldexp(FixedPointType(1), -2 * (FixedPointType::range - 1)));
+
+    // Check exact values.
+    BOOST_CHECK_EQUAL(log2(FixedPointType(1)),     FixedPointType(0));
+    BOOST_CHECK_EQUAL(log2(FixedPointType(8)),     FixedPointType(3));
+    BOOST_CHECK_EQUAL(log2(FixedPointType(1) / 4), FixedPointType(-2));
+    BOOST_CHECK_EQUAL(log (FixedPointType(1)),     FixedPointType(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_log2_pow)
+{
+  // Test log2(), pow(), exp() and log() for negatable in the polynomial tiers and the wide tiers.
+
+  { typedef boost::fixed_point::negatable< 5,  -10>                                         fixed_point_type; local::test_log2_pow<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable< 7,  -24>                                         fixed_point_type; local::test_log2_pow<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<15,  -48>                                         fixed_point_type; local::test_log2_pow<fixed_point_type>(5); }
+  { typedef boost::fixed_point::negatable<10, -117, boost::fixed_point::round::nearest_even> fixed_point_type; local::test_log2_pow<fixed_point_type>(5); }
+}
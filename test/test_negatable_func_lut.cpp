@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the table-based elementary functions of (fixed_point) against long double.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define BOOST_TEST_MODULE test_negatable_func_lut
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  bool is_close(const NegatableType& x, const long double reference, const bool is_relative)
+  {
+    using std::fabs;
+    using std::ldexp;
+
+    // The documented maximum error is one unit of the resolution,
+    // relative to the result for exp and sqrt.
+    const long double tolerance = ldexp(1.0L, NegatableType::resolution) * (is_relative ? (std::max)(1.0L, fabs(reference)) : 1.0L);
+
+    return (fabs(static_cast<long double>(x) - reference) <= tolerance);
+  }
+
+  template<typename NegatableType>
+  void test_lut(const long long step)
+  {
+    typedef typename NegatableType::value_type local_value_type;
+    typedef typename NegatableType::nothing    local_nothing;
+
+    const long long lo = static_cast<long long>(std::numeric_limits<NegatableType>::lowest().crepresentation()) + 1;
+    const long long hi = static_cast<long long>((std::numeric_limits<NegatableType>::max)().crepresentation());
+
+    using std::log;
+
+    const long double exp_limit = log(static_cast<long double>((std::numeric_limits<NegatableType>::max)()));
+
+    for(long long n = lo; n <= hi; n += step)
+    {
+      const NegatableType x = NegatableType(local_nothing(), local_value_type(n));
+      const long double   u = static_cast<long double>(x);
+
+      BOOST_CHECK(is_close(boost::fixed_point::lut::sin (x), std::sin (u), false));
+      BOOST_CHECK(is_close(boost::fixed_point::lut::cos (x), std::cos (u), false));
+      BOOST_CHECK(is_close(boost::fixed_point::lut::atan(x), std::atan(u), false));
+
+      if(u < exp_limit)
+      {
+        BOOST_CHECK(is_close(boost::fixed_point::lut::exp(x), std::exp(u), true));
+      }
+
+      if(n > 0)
+      {
+        BOOST_CHECK(is_close(boost::fixed_point::lut::log (x), std::log (u), false));
+        BOOST_CHECK(is_close(boost::fixed_point::lut::sqrt(x), std::sqrt(u), true));
+      }
+    }
+
+    BOOST_CHECK_EQUAL(boost::fixed_point::lut::sqrt(NegatableType(0)), NegatableType(0));
+    BOOST_CHECK_EQUAL(boost::fixed_point::lut::sqrt(NegatableType(4)), NegatableType(2));
+    BOOST_CHECK_EQUAL(boost::fixed_point::lut::exp (NegatableType(0)), NegatableType(1));
+    BOOST_CHECK_EQUAL(boost::fixed_point::lut::log (NegatableType(1)), NegatableType(0));
+    BOOST_CHECK_EQUAL(boost::fixed_point::lut::log (NegatableType(0)), -(std::numeric_limits<NegatableType>::max)());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_lut)
+{
+  local::test_lut<boost::fixed_point::negatable< 3,  -4>>(1);
+  local::test_lut<boost::fixed_point::negatable< 4, -11>>(1);
+  local::test_lut<boost::fixed_point::negatable<15, -16>>(70001);
+  local::test_lut<boost::fixed_point::negatable< 7, -24>>(99991);
+}
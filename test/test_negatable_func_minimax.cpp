@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the minimax polynomial tiers of the elementary functions of (fixed_point) for 32, 48 and 64 fractional bits.
+
+#include <cmath>
+#include <cstdint>
+
+#define BOOST_TEST_MODULE test_negatable_func_minimax
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  long double to_long_double(const NegatableType& x)
+  {
+    return std::ldexp(static_cast<long double>(x.crepresentation()), NegatableType::resolution);
+  }
+
+  template<typename NegatableType>
+  NegatableType from_long_double(const long double x)
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    return NegatableType(nothing(), value_type(std::llround(std::ldexp(x, -NegatableType::resolution))));
+  }
+
+  template<typename NegatableType>
+  void test_minimax(const int fuzzy_bits)
+  {
+    // The long double reference has 64 binary digits. This limits the
+    // check of the absolute error to types with up to 53 fractional bits.
+    // The argument reduction of exp amplifies the error of log(2) * n.
+    const long double tol = std::ldexp(1.0L, NegatableType::resolution + fuzzy_bits);
+
+    // Use a simple linear congruential generator for the arguments.
+    std::uint32_t seed = UINT32_C(12345);
+
+    for(int i = 0; i < 500; ++i)
+    {
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const long double u = static_cast<long double>(seed) / 4294967296.0L;
+
+      const NegatableType x_trig = from_long_double<NegatableType>(u * 3.0L);
+      const NegatableType x_exp  = from_long_double<NegatableType>((u * 4.0L) - 2.0L);
+      const NegatableType x_log  = from_long_double<NegatableType>((u * 8.0L) + 0.125L);
+      const NegatableType x_atan = from_long_double<NegatableType>((u * 4.0L) - 2.0L);
+
+      BOOST_CHECK(std::fabs(to_long_double(sin (x_trig)) - std::sin (to_long_double(x_trig))) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(cos (x_trig)) - std::cos (to_long_double(x_trig))) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(exp (x_exp))  - std::exp (to_long_double(x_exp)))  <= (tol * 8));
+      BOOST_CHECK(std::fabs(to_long_double(log (x_log))  - std::log (to_long_double(x_log)))  <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(atan(x_atan)) - std::atan(to_long_double(x_atan))) <= tol);
+      BOOST_CHECK(std::fabs(to_long_double(sqrt(x_log))  - std::sqrt(to_long_double(x_log)))  <= tol);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_minimax)
+{
+  // The tier of 32 fractional bits.
+  local::test_minimax<boost::fixed_point::negatable<31, -32>>(4);
+
+  // The tier of 48 fractional bits.
+  local::test_minimax<boost::fixed_point::negatable<15, -48>>(4);
+
+  // The tier of 64 fractional bits, here with 53 bits, checked to the precision of long double.
+  local::test_minimax<boost::fixed_point::negatable< 7, -53>>(4);
+}
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the fast and accurate policies of the elementary functions of (fixed_point).
+
+#include <cmath>
+#include <type_traits>
+
+#define BOOST_TEST_MODULE test_negatable_func_policy
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  // Check that the function value u is within the given number of units
+  // of the resolution of the reference value v, relative to the larger of 1 and v.
+  template<typename NegatableType>
+  bool is_close(const NegatableType& u, const long double v, const long double ulps)
+  {
+    const long double tolerance = std::ldexp(ulps, NegatableType::resolution) * ((std::fabs(v) > 1.0L) ? std::fabs(v) : 1.0L);
+
+    return (std::fabs(static_cast<long double>(u) - v) <= tolerance);
+  }
+
+  template<typename NegatableType>
+  void test_accurate(const long double ulps)
+  {
+    for(int i = -15; i <= 15; ++i)
+    {
+      const NegatableType x = NegatableType(i) / 8;
+      const long double   v = static_cast<long double>(x);
+
+      BOOST_CHECK(is_close(boost::fixed_point::accurate::sin (x), std::sin (v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::accurate::cos (x), std::cos (v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::accurate::atan(x), std::atan(v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::accurate::tanh(x), std::tanh(v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::accurate::exp (x), std::exp (v), ulps));
+
+      if(i > 0)
+      {
+        BOOST_CHECK(is_close(boost::fixed_point::accurate::log (x), std::log (v), ulps));
+        BOOST_CHECK(is_close(boost::fixed_point::accurate::sqrt(x), std::sqrt(v), ulps));
+      }
+
+      if((i > -8) && (i < 8))
+      {
+        BOOST_CHECK(is_close(boost::fixed_point::accurate::asin(x), std::asin(v), ulps));
+      }
+    }
+  }
+
+  template<typename NegatableType>
+  void test_fast(const long double working_ulps)
+  {
+    typedef typename boost::fixed_point::detail::policy_helper<NegatableType>::fast_type working_type;
+
+    // The fast functions are the functions of the working type, rounded back
+    // to the argument type. Their error is that of the working type.
+    const long double ulps = std::ldexp(working_ulps, NegatableType::radix_split - working_type::radix_split);
+
+    for(int i = -15; i <= 15; ++i)
+    {
+      const NegatableType x = NegatableType(i) / 8;
+      const long double   v = static_cast<long double>(x);
+
+      BOOST_CHECK(is_close(boost::fixed_point::fast::sin (x), std::sin (v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::fast::cos (x), std::cos (v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::fast::atan(x), std::atan(v), ulps));
+      BOOST_CHECK(is_close(boost::fixed_point::fast::exp (x), std::exp (v), ulps));
+
+      BOOST_CHECK_EQUAL(boost::fixed_point::fast::sin(x), NegatableType(boost::fixed_point::sin(working_type(x))));
+
+      if(i > 0)
+      {
+        BOOST_CHECK(is_close(boost::fixed_point::fast::log (x), std::log (v), ulps));
+        BOOST_CHECK(is_close(boost::fixed_point::fast::sqrt(x), std::sqrt(v), ulps));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_policy)
+{
+  using boost::fixed_point::negatable;
+  using boost::fixed_point::round::nearest_even;
+
+  // The working types select the tiers of the algorithms.
+  typedef boost::fixed_point::detail::policy_helper<negatable< 4, -11>> helper_a;
+  typedef boost::fixed_point::detail::policy_helper<negatable< 7, -24>> helper_b;
+  typedef boost::fixed_point::detail::policy_helper<negatable<15, -48>> helper_c;
+
+  BOOST_STATIC_ASSERT(std::is_same<helper_a::fast_type,     negatable< 4, -11>>::value);
+  BOOST_STATIC_ASSERT(std::is_same<helper_a::accurate_type, negatable< 4, -19>>::value);
+  BOOST_STATIC_ASSERT(std::is_same<helper_b::fast_type,     negatable< 7, -11>>::value);
+  BOOST_STATIC_ASSERT(std::is_same<helper_b::accurate_type, negatable< 7, -32>>::value);
+  BOOST_STATIC_ASSERT(std::is_same<helper_c::fast_type,     negatable<15, -24>>::value);
+
+  local::test_accurate<negatable<4, -11>>              (2.0L);
+  local::test_accurate<negatable<4, -11, nearest_even>>(2.0L);
+  local::test_accurate<negatable<7, -24>>              (2.0L);
+
+  local::test_fast<negatable< 7, -24>>( 16.0L);
+  local::test_fast<negatable<15, -48>>(256.0L);
+
+  // The lowest tier is its own fast working type.
+  typedef negatable<4, -11> fixed_point_type;
+
+  for(int i = 1; i < 64; ++i)
+  {
+    const fixed_point_type x = fixed_point_type(i) / 16;
+
+    BOOST_CHECK_EQUAL(boost::fixed_point::fast::sin (x), boost::fixed_point::sin (x));
+    BOOST_CHECK_EQUAL(boost::fixed_point::fast::sqrt(x), boost::fixed_point::sqrt(x));
+  }
+}
@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the reciprocal recip and the reciprocal square root rsqrt of (fixed_point).
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#define BOOST_TEST_MODULE test_negatable_func_recip
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  // Check the reciprocal R of the representation X against the exact value 2^(2 * radix_split) / X.
+  // When rounding to nearest, (2R - 1) * X <= 2^(2 * radix_split + 1) < (2R + 1) * X.
+  // Otherwise the error is less than two ULP. Results beyond the range saturate.
+  template<typename NegatableType>
+  bool recip_is_close(const NegatableType& x, const bool round_to_nearest)
+  {
+    const NegatableType r = boost::fixed_point::recip(x);
+
+    const std::int64_t xx = std::int64_t(x.crepresentation());
+    const std::int64_t rr = std::int64_t(r.crepresentation());
+
+    if((rr != 0) && ((xx < 0) != (rr < 0)))
+    {
+      return false;
+    }
+
+    const std::int64_t u     = ((xx < 0) ? -xx : xx);
+    const std::int64_t v     = ((rr < 0) ? -rr : rr);
+    const std::int64_t v_max = std::int64_t((std::numeric_limits<NegatableType>::max)().crepresentation());
+    const std::int64_t p     = std::int64_t(INT64_C(1) << (2 * NegatableType::radix_split));
+
+    if((p / u) >= v_max)
+    {
+      return (v == v_max);
+    }
+
+    return (round_to_nearest ? ((((2 * v) - 1) * u) <= (2 * p)) && ((2 * p) < (((2 * v) + 1) * u))
+                             : (((v * u) - p) < (2 * u)) && ((p - (v * u)) < (2 * u)));
+  }
+
+  // Check the reciprocal square root to within two ULP.
+  template<typename NegatableType>
+  bool rsqrt_is_close(const NegatableType& x)
+  {
+    const NegatableType r = boost::fixed_point::rsqrt(x);
+
+    const long double xx    = std::ldexp(static_cast<long double>(x.crepresentation()), NegatableType::resolution);
+    const long double v     = std::ldexp(1.0L / std::sqrt(xx), NegatableType::radix_split);
+    const long double v_max = static_cast<long double>((std::numeric_limits<NegatableType>::max)().crepresentation());
+
+    if(v >= v_max)
+    {
+      return (static_cast<long double>(r.crepresentation()) == v_max);
+    }
+
+    return (std::fabs(static_cast<long double>(r.crepresentation()) - v) < 2.0L);
+  }
+
+  template<typename NegatableType>
+  void test_recip_exhaustive(const bool round_to_nearest)
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    const value_type x_max = (std::numeric_limits<NegatableType>::max)().crepresentation();
+
+    for(value_type i = -x_max; i < x_max; ++i)
+    {
+      if(i != 0)
+      {
+        BOOST_CHECK(recip_is_close(NegatableType(nothing(), i), round_to_nearest));
+      }
+
+      if(i > 0)
+      {
+        BOOST_CHECK(rsqrt_is_close(NegatableType(nothing(), i)));
+      }
+    }
+  }
+
+  template<typename NegatableType>
+  void test_recip_random(const bool round_to_nearest)
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    // Use a simple linear congruential generator for arguments
+    // spread over the whole range of the fixed-point type.
+    std::uint32_t seed = UINT32_C(12345);
+
+    for(int i = 0; i < 10000; ++i)
+    {
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const value_type x = value_type((seed & UINT32_C(0x7FFFFFFF)) >> ((seed >> 8) % 31U));
+
+      if(x > 0)
+      {
+        BOOST_CHECK(recip_is_close(NegatableType(nothing(),  x), round_to_nearest));
+        BOOST_CHECK(recip_is_close(NegatableType(nothing(), -x), round_to_nearest));
+        BOOST_CHECK(rsqrt_is_close(NegatableType(nothing(),  x)));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_recip)
+{
+  using boost::fixed_point::negatable;
+  using boost::fixed_point::round::fastest;
+  using boost::fixed_point::round::nearest_even;
+  using boost::fixed_point::round::classic;
+
+  local::test_recip_exhaustive<negatable< 7,  -8, nearest_even>>(true);
+  local::test_recip_exhaustive<negatable< 7,  -8, fastest>>     (false);
+  local::test_recip_exhaustive<negatable< 4,  -3, classic>>     (true);
+  local::test_recip_exhaustive<negatable<10,  -5, fastest>>     (false);
+
+  local::test_recip_random<negatable< 7, -24, nearest_even>>(true);
+  local::test_recip_random<negatable< 7, -24, fastest>>     (false);
+  local::test_recip_random<negatable<15, -16, classic>>     (true);
+  local::test_recip_random<negatable<15, -16, fastest>>     (false);
+
+  // Exact values.
+  typedef negatable<15, -16> fixed_point_type;
+
+  BOOST_CHECK(boost::fixed_point::recip(fixed_point_type(2U))  == (fixed_point_type(1U) / 2U));
+  BOOST_CHECK(boost::fixed_point::recip(fixed_point_type(-4))  == -(fixed_point_type(1U) / 4U));
+  BOOST_CHECK(boost::fixed_point::recip(fixed_point_type(0U))  == fixed_point_type(0U));
+  BOOST_CHECK(boost::fixed_point::rsqrt(fixed_point_type(4U))  == (fixed_point_type(1U) / 2U));
+  BOOST_CHECK(boost::fixed_point::rsqrt(fixed_point_type(1U) / 16U) == fixed_point_type(4U));
+  BOOST_CHECK(boost::fixed_point::rsqrt(fixed_point_type(0U))  == fixed_point_type(0U));
+  BOOST_CHECK(boost::fixed_point::rsqrt(fixed_point_type(-1))  == fixed_point_type(0U));
+}
@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the combined sine and cosine function sincos of (fixed_point) and its batch version.
+
+#include <cstddef>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_negatable_func_sincos
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  template<typename NegatableType>
+  void test_sincos(const int range_in_tenths, const int fuzzy_bits)
+  {
+    const NegatableType tol = ldexp(NegatableType(1), NegatableType::resolution + fuzzy_bits);
+
+    std::vector<NegatableType> x;
+
+    for(int i = -range_in_tenths; i <= range_in_tenths; ++i)
+    {
+      x.push_back(NegatableType(static_cast<float>(i) / 10));
+    }
+
+    std::vector<NegatableType> s(x.size());
+    std::vector<NegatableType> c(x.size());
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      boost::fixed_point::sincos(x[i], &s[i], &c[i]);
+
+      BOOST_CHECK(fabs(s[i] - sin(x[i])) <= tol);
+      BOOST_CHECK(fabs(c[i] - cos(x[i])) <= tol);
+    }
+
+    // The batch version is bit-identical to the scalar version.
+    std::vector<NegatableType> s_batch(x.size());
+    std::vector<NegatableType> c_batch(x.size());
+
+    boost::fixed_point::batch::sincos(x.data(), s_batch.data(), c_batch.data(), x.size());
+
+    BOOST_CHECK(s_batch == s);
+    BOOST_CHECK(c_batch == c);
+
+    // Check in-place evaluation.
+    std::vector<NegatableType> y(x);
+
+    boost::fixed_point::batch::sincos(y.data(), y.data(), c_batch.data(), y.size());
+
+    BOOST_CHECK(y == s);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_sincos)
+{
+  local::test_sincos<boost::fixed_point::negatable< 4, -11>>(150, 2);
+  local::test_sincos<boost::fixed_point::negatable< 7, -24>>(700, 2);
+  local::test_sincos<boost::fixed_point::negatable<10, -53>>(700, 4);
+}
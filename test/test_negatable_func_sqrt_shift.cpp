@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Tests the digit-recurrence square root shift::sqrt of (fixed_point) for correct rounding.
+
+#include <cstdint>
+#include <limits>
+
+#define BOOST_TEST_MODULE test_negatable_func_sqrt_shift
+#define BOOST_LIB_DIAGNOSTIC
+
+#include <boost/fixed_point/fixed_point.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+namespace local
+{
+  // Check that the result is the square root of the radicand N = X * 2^radix_split
+  // correctly rounded to nearest, i.e. R^2 - R < N <= R^2 + R.
+  template<typename NegatableType>
+  bool sqrt_is_correctly_rounded(const NegatableType& x)
+  {
+    const NegatableType r = boost::fixed_point::shift::sqrt(x);
+
+    const std::uint64_t n  = std::uint64_t(std::uint64_t(x.crepresentation()) << NegatableType::radix_split);
+    const std::uint64_t rr = std::uint64_t(r.crepresentation());
+
+    return (((rr * rr) - rr) < n) && (n <= ((rr * rr) + rr));
+  }
+
+  template<typename NegatableType>
+  void test_sqrt_shift_exhaustive()
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    const value_type x_max = (std::numeric_limits<NegatableType>::max)().crepresentation();
+
+    for(value_type i = 1; i < x_max; ++i)
+    {
+      BOOST_CHECK(sqrt_is_correctly_rounded(NegatableType(nothing(), i)));
+    }
+  }
+
+  template<typename NegatableType>
+  void test_sqrt_shift_random()
+  {
+    typedef typename NegatableType::value_type value_type;
+    typedef typename NegatableType::nothing    nothing;
+
+    // Use a simple linear congruential generator for arguments
+    // spread over the whole range of the fixed-point type.
+    std::uint32_t seed = UINT32_C(12345);
+
+    for(int i = 0; i < 10000; ++i)
+    {
+      seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+      const value_type x = value_type((seed & UINT32_C(0x7FFFFFFF)) >> ((seed >> 8) % 31U));
+
+      if(x > 0)
+      {
+        BOOST_CHECK(sqrt_is_correctly_rounded(NegatableType(nothing(), x)));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_negatable_func_sqrt_shift)
+{
+  local::test_sqrt_shift_exhaustive<boost::fixed_point::negatable< 7,  -8>>();
+  local::test_sqrt_shift_exhaustive<boost::fixed_point::negatable< 0, -15>>();
+  local::test_sqrt_shift_exhaustive<boost::fixed_point::negatable<10,  -5>>();
+
+  local::test_sqrt_shift_random<boost::fixed_point::negatable< 7, -24>>();
+  local::test_sqrt_shift_random<boost::fixed_point::negatable<15, -16>>();
+  local::test_sqrt_shift_random<boost::fixed_point::negatable< 0, -31>>();
+
+  // Exact squares.
+  typedef boost::fixed_point::negatable<15, -16> fixed_point_type;
+
+  BOOST_CHECK(boost::fixed_point::shift::sqrt(fixed_point_type(144U)) == fixed_point_type(12U));
+  BOOST_CHECK(boost::fixed_point::shift::sqrt(fixed_point_type(1U) / 4U) == (fixed_point_type(1U) / 2U));
+  BOOST_CHECK(boost::fixed_point::shift::sqrt(fixed_point_type(0U)) == fixed_point_type(0U));
+  BOOST_CHECK(boost::fixed_point::shift::sqrt(fixed_point_type(-4)) == fixed_point_type(0U));
+}
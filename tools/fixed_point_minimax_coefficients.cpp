@@ -0,0 +1,474 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2016.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! \file
+//!\brief Offline tool generating the minimax polynomial coefficients of
+//! boost/fixed_point/detail/fixed_point_detail_minimax.hpp.
+
+// This program uses the Remez exchange algorithm in order to compute
+// minimax polynomial approximations of the elementary functions for
+// the resolution tiers of 32, 48 and 64 fractional bits. For each tier,
+// the smallest degree is chosen whose maximum absolute error lies below
+// 2^-(tier + 2). The resulting coefficients are written to standard output
+// in the form of the header fixed_point_detail_minimax.hpp.
+//
+// Usage:
+//   fixed_point_minimax_coefficients > fixed_point_detail_minimax.hpp
+//
+// The coefficients are stored as an unsigned 64-bit mantissa together
+// with a binary exponent and a sign, so that they can be scaled to
+// the representation of any fixed-point type without loss of precision.
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+namespace local
+{
+  typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<256U,
+                                                                                       boost::multiprecision::backends::digit_base_2>,
+                                        boost::multiprecision::et_off>
+  float_type;
+
+  typedef float_type(*function_type)(const float_type&);
+
+  float_type pi() { return boost::math::constants::pi<float_type>(); }
+
+  // The functions to be approximated, each one expressed in the
+  // variable t of the polynomial.
+
+  // sin(x) = x * P(t), with t = x^2 and 0 <= x <= pi/4.
+  float_type sin_over_x(const float_type& t)
+  {
+    if(t == 0) { return float_type(1U); }
+
+    const float_type x = sqrt(t);
+
+    return sin(x) / x;
+  }
+
+  // cos(x) = P(t), with t = x^2 and 0 <= x <= pi/4.
+  float_type cos_of_root(const float_type& t)
+  {
+    return cos(sqrt(t));
+  }
+
+  // exp(x) = P(x), with -log(2)/2 <= x <= +log(2)/2.
+  float_type exp_of_x(const float_type& x)
+  {
+    return exp(x);
+  }
+
+  // expm1(x) = x * P(x), with -log(2)/2 <= x <= +log(2)/2.
+  float_type expm1_over_x(const float_type& x)
+  {
+    if(x == 0) { return float_type(1U); }
+
+    return expm1(x) / x;
+  }
+
+  // log(x) = 2 * s * P(t), with s = (x - 1) / (x + 1), t = s^2
+  // and 1/sqrt(2) <= x <= sqrt(2). Here, P(t) = atanh(s) / s.
+  float_type atanh_over_s(const float_type& t)
+  {
+    if(t == 0) { return float_type(1U); }
+
+    const float_type s = sqrt(t);
+
+    return atanh(s) / s;
+  }
+
+  // atan(x) = x * P(t), with t = x^2 and 0 <= x <= tan(pi/8).
+  float_type atan_over_x(const float_type& t)
+  {
+    if(t == 0) { return float_type(1U); }
+
+    const float_type x = sqrt(t);
+
+    return atan(x) / x;
+  }
+
+  // sqrt(x) = P(x), with 1/4 <= x <= 1. This is the initial estimate
+  // for the subsequent Newton-Raphson iteration of the square root.
+  float_type sqrt_of_x(const float_type& x)
+  {
+    return sqrt(x);
+  }
+
+  float_type evaluate(const std::vector<float_type>& c, const float_type& t)
+  {
+    float_type sum(0U);
+
+    for(std::size_t k = c.size(); k > 0U; --k)
+    {
+      sum = (sum * t) + c[k - 1U];
+    }
+
+    return sum;
+  }
+
+  // Solve the linear system a * x = b with Gaussian elimination and partial pivoting.
+  std::vector<float_type> solve(std::vector<std::vector<float_type>> a, std::vector<float_type> b)
+  {
+    const std::size_t n = b.size();
+
+    for(std::size_t col = 0U; col < n; ++col)
+    {
+      std::size_t pivot = col;
+
+      for(std::size_t row = col + 1U; row < n; ++row)
+      {
+        if(fabs(a[row][col]) > fabs(a[pivot][col])) { pivot = row; }
+      }
+
+      std::swap(a[col], a[pivot]);
+      std::swap(b[col], b[pivot]);
+
+      for(std::size_t row = col + 1U; row < n; ++row)
+      {
+        const float_type factor = a[row][col] / a[col][col];
+
+        for(std::size_t k = col; k < n; ++k) { a[row][k] -= factor * a[col][k]; }
+
+        b[row] -= factor * b[col];
+      }
+    }
+
+    std::vector<float_type> x(n);
+
+    for(std::size_t row = n; row > 0U; --row)
+    {
+      float_type sum = b[row - 1U];
+
+      for(std::size_t k = row; k < n; ++k) { sum -= a[row - 1U][k] * x[k]; }
+
+      x[row - 1U] = sum / a[row - 1U][row - 1U];
+    }
+
+    return x;
+  }
+
+  // Compute the minimax polynomial of degree n for the function f in the
+  // range [a, b] with the Remez exchange algorithm. Return the coefficients
+  // and provide the maximum absolute error.
+  std::vector<float_type> remez(function_type f,
+                                const float_type& a,
+                                const float_type& b,
+                                const std::size_t n,
+                                float_type& max_error)
+  {
+    const std::size_t point_count = n + 2U;
+
+    // Begin with the extrema of the Chebyshev polynomial of degree (n + 1).
+    std::vector<float_type> points(point_count);
+
+    for(std::size_t i = 0U; i < point_count; ++i)
+    {
+      points[i] = ((a + b) / 2) - (((b - a) / 2) * cos((pi() * i) / (n + 1U)));
+    }
+
+    std::vector<float_type> c;
+
+    const std::size_t grid_count = 64U * point_count;
+
+    for(int iteration = 0; iteration < 32; ++iteration)
+    {
+      // Solve sum_j c_j * t_i^j + (-1)^i * E = f(t_i) for the coefficients c_j and E.
+      std::vector<std::vector<float_type>> m(point_count, std::vector<float_type>(point_count));
+      std::vector<float_type>              rhs(point_count);
+
+      for(std::size_t i = 0U; i < point_count; ++i)
+      {
+        float_type power(1U);
+
+        for(std::size_t j = 0U; j <= n; ++j)
+        {
+          m[i][j] = power;
+          power *= points[i];
+        }
+
+        m[i][n + 1U] = (((i % 2U) == 0U) ? float_type(1) : float_type(-1));
+        rhs[i]       = f(points[i]);
+      }
+
+      const std::vector<float_type> solution = solve(m, rhs);
+
+      c.assign(solution.begin(), solution.begin() + std::ptrdiff_t(n + 1U));
+
+      const float_type level = fabs(solution.back());
+
+      // Locate the extrema of the error on a grid, one per run of equal sign.
+      std::vector<float_type> grid(grid_count + 1U);
+      std::vector<float_type> error(grid_count + 1U);
+
+      for(std::size_t i = 0U; i <= grid_count; ++i)
+      {
+        grid[i]  = ((a + b) / 2) - (((b - a) / 2) * cos((pi() * i) / grid_count));
+        error[i] = evaluate(c, grid[i]) - f(grid[i]);
+      }
+
+      std::vector<std::size_t> extrema;
+
+      for(std::size_t i = 0U; i <= grid_count; ++i)
+      {
+        if(extrema.empty() || ((error[i] < 0) != (error[extrema.back()] < 0)))
+        {
+          extrema.push_back(i);
+        }
+        else if(fabs(error[i]) > fabs(error[extrema.back()]))
+        {
+          extrema.back() = i;
+        }
+      }
+
+      // Remove surplus extrema from the ends of the range.
+      while(extrema.size() > point_count)
+      {
+        if(fabs(error[extrema.front()]) < fabs(error[extrema.back()]))
+        {
+          extrema.erase(extrema.begin());
+        }
+        else
+        {
+          extrema.pop_back();
+        }
+      }
+
+      if(extrema.size() < point_count)
+      {
+        // The error does not alternate sufficiently. This happens when the
+        // error has reached the precision of the floating-point type.
+        max_error = level;
+
+        break;
+      }
+
+      // Refine each extremum with a golden section search.
+      max_error = 0;
+
+      for(std::size_t i = 0U; i < point_count; ++i)
+      {
+        const std::size_t k = extrema[i];
+
+        float_type lo = grid[(k > 0U) ? (k - 1U) : k];
+        float_type hi = grid[(k < grid_count) ? (k + 1U) : k];
+
+        const float_type sign = ((error[k] < 0) ? float_type(-1) : float_type(1));
+
+        const float_type golden = (sqrt(float_type(5U)) - 1) / 2;
+
+        for(int j = 0; j < 64; ++j)
+        {
+          const float_type t1 = hi - (golden * (hi - lo));
+          const float_type t2 = lo + (golden * (hi - lo));
+
+          if((sign * (evaluate(c, t1) - f(t1))) > (sign * (evaluate(c, t2) - f(t2)))) { hi = t2; }
+          else                                                                      { lo = t1; }
+        }
+
+        const float_type t = (((k == 0U) || (k == grid_count)) ? grid[k] : float_type((lo + hi) / 2));
+
+        points[i] = t;
+
+        const float_type e = fabs(evaluate(c, t) - f(t));
+
+        if(e > max_error) { max_error = e; }
+      }
+
+      if(((max_error - level) / level) < float_type(1.0E-6))
+      {
+        break;
+      }
+    }
+
+    return c;
+  }
+
+  // Print a coefficient in the form { mantissa, exponent, is_neg },
+  // representing (-1)^is_neg * mantissa * 2^exponent.
+  std::string coefficient_string(const float_type& c)
+  {
+    std::stringstream ss;
+
+    if(c == 0)
+    {
+      ss << "{ UINT64_C(0x0000000000000000),    0, false }";
+
+      return ss.str();
+    }
+
+    int e;
+
+    const float_type fraction = frexp(fabs(c), &e);
+
+    const float_type scaled = floor(ldexp(fraction, 64) + float_type(0.5F));
+
+    std::uint64_t mantissa;
+    int           exponent = e - 64;
+
+    if(scaled >= ldexp(float_type(1U), 64))
+    {
+      mantissa = UINT64_C(0x8000000000000000);
+      ++exponent;
+    }
+    else
+    {
+      mantissa = scaled.convert_to<std::uint64_t>();
+    }
+
+    ss << "{ UINT64_C(0x"
+       << std::hex << std::uppercase << std::setw(16) << std::setfill('0') << mantissa
+       << "), "
+       << std::dec << std::setw(4) << std::setfill(' ') << exponent
+       << ", "
+       << ((c < 0) ? "true " : "false")
+       << " }";
+
+    return ss.str();
+  }
+
+  struct approximation
+  {
+    std::string   name;
+    std::string   description;
+    function_type f;
+    float_type    a;
+    float_type    b;
+    int           fixed_degree;
+  };
+
+  void print_table(const approximation& approx, const int tier)
+  {
+    std::vector<float_type> c;
+
+    float_type max_error;
+
+    const float_type target = ldexp(float_type(1U), -(tier + 2));
+
+    std::size_t n = ((approx.fixed_degree > 0) ? std::size_t(approx.fixed_degree) : 1U);
+
+    for( ; ; ++n)
+    {
+      c = remez(approx.f, approx.a, approx.b, n, max_error);
+
+      if((approx.fixed_degree > 0) || (max_error < target))
+      {
+        break;
+      }
+    }
+
+    const int precision_bits = int(floor(-log2(max_error)).convert_to<int>());
+
+    std::cout << "  template<>\r\n"
+              << "  struct minimax_" << approx.name << "<" << tier << ">\r\n"
+              << "  {\r\n"
+              << "    BOOST_STATIC_CONSTEXPR std::size_t coefficient_count = " << c.size() << "U;\r\n"
+              << "    BOOST_STATIC_CONSTEXPR int         precision_bits    = " << precision_bits << ";\r\n"
+              << "\r\n"
+              << "    static const minimax_coefficient* coefficients()\r\n"
+              << "    {\r\n"
+              << "      static const minimax_coefficient the_coefficients[coefficient_count] =\r\n"
+              << "      {\r\n";
+
+    for(std::size_t k = 0U; k < c.size(); ++k)
+    {
+      std::cout << "        " << coefficient_string(c[k]) << ((k + 1U < c.size()) ? "," : " ") << "  // c" << k << "\r\n";
+    }
+
+    std::cout << "      };\r\n"
+              << "\r\n"
+              << "      return the_coefficients;\r\n"
+              << "    }\r\n"
+              << "  };\r\n"
+              << "\r\n";
+  }
+}
+
+int main()
+{
+  const local::float_type ln_two      = log(local::float_type(2U));
+  const local::float_type tan_pi_8    = tan(local::pi() / 8);
+  const local::float_type s_max       = (sqrt(local::float_type(2U)) - 1) / (sqrt(local::float_type(2U)) + 1);
+  const local::float_type pi_quarter2 = (local::pi() / 4) * (local::pi() / 4);
+
+  const std::vector<local::approximation> approximations =
+  {{
+    { "sin",   "sin(x) = x * P(x^2), for 0 <= x <= pi/4",                             local::sin_over_x,   local::float_type(0U), pi_quarter2,         0 },
+    { "cos",   "cos(x) = P(x^2), for 0 <= x <= pi/4",                                 local::cos_of_root,  local::float_type(0U), pi_quarter2,         0 },
+    { "exp",   "exp(x) = P(x), for -log(2)/2 <= x <= +log(2)/2",                      local::exp_of_x,     -ln_two / 2,           ln_two / 2,          0 },
+    { "expm1", "expm1(x) = x * P(x), for -log(2)/2 <= x <= +log(2)/2",                local::expm1_over_x, -ln_two / 2,           ln_two / 2,          0 },
+    { "log",   "log(x) = 2 * s * P(s^2), s = (x - 1) / (x + 1), 1/sqrt(2) <= x <= sqrt(2)", local::atanh_over_s, local::float_type(0U), s_max * s_max, 0 },
+    { "atan",  "atan(x) = x * P(x^2), for 0 <= x <= tan(pi/8)",                       local::atan_over_x,  local::float_type(0U), tan_pi_8 * tan_pi_8, 0 },
+    { "sqrt",  "sqrt(x) = P(x), for 1/4 <= x <= 1, as an initial estimate",           local::sqrt_of_x,    local::float_type(0.25F), local::float_type(1U), 3 }
+  }};
+
+  const int tiers[3U] = { 32, 48, 64 };
+
+  std::cout << "///////////////////////////////////////////////////////////////////////////////\r\n"
+            << "//  Copyright Christopher Kormanyos 2016.\r\n"
+            << "// Distributed under the Boost Software License,\r\n"
+            << "// Version 1.0. (See accompanying file LICENSE_1_0.txt\r\n"
+            << "// or copy at http://www.boost.org/LICENSE_1_0.txt)\r\n"
+            << "//\r\n"
+            << "\r\n"
+            << "// fixed_point_detail_minimax.hpp provides the coefficients of minimax\r\n"
+            << "// polynomial approximations of elementary functions for the resolution\r\n"
+            << "// tiers of 32, 48 and 64 fractional bits.\r\n"
+            << "//\r\n"
+            << "// This file has been generated by tools/fixed_point_minimax_coefficients.cpp.\r\n"
+            << "// Do not edit it by hand.\r\n"
+            << "\r\n"
+            << "#ifndef FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_\r\n"
+            << "  #define FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_\r\n"
+            << "\r\n"
+            << "  #include <cstddef>\r\n"
+            << "  #include <cstdint>\r\n"
+            << "\r\n"
+            << "  #include <boost/config.hpp>\r\n"
+            << "\r\n"
+            << "  namespace boost { namespace fixed_point { namespace detail {\r\n"
+            << "\r\n"
+            << "  // A coefficient has the value (-1)^is_neg * mantissa * 2^exponent.\r\n"
+            << "  struct minimax_coefficient\r\n"
+            << "  {\r\n"
+            << "    std::uint64_t mantissa;\r\n"
+            << "    int           exponent;\r\n"
+            << "    bool          is_neg;\r\n"
+            << "  };\r\n"
+            << "\r\n"
+            << "  // Select the tier of the coefficients for a given fractional resolution.\r\n"
+            << "  // The tier is zero if no coefficients are available.\r\n"
+            << "  template<const int RadixSplit>\r\n"
+            << "  struct minimax_tier\r\n"
+            << "  {\r\n"
+            << "    BOOST_STATIC_CONSTEXPR int value = ((RadixSplit <= 32) ? 32\r\n"
+            << "                                     : ((RadixSplit <= 48) ? 48\r\n"
+            << "                                     : ((RadixSplit <= 64) ? 64 : 0)));\r\n"
+            << "  };\r\n"
+            << "\r\n";
+
+  for(std::size_t i = 0U; i < approximations.size(); ++i)
+  {
+    std::cout << "  // " << approximations[i].description << ".\r\n"
+              << "  template<const int Tier>\r\n"
+              << "  struct minimax_" << approximations[i].name << ";\r\n"
+              << "\r\n";
+
+    for(std::size_t j = 0U; j < 3U; ++j)
+    {
+      local::print_table(approximations[i], tiers[j]);
+    }
+  }
+
+  std::cout << "  } } } // namespace boost::fixed_point::detail\r\n"
+            << "\r\n"
+            << "#endif // FIXED_POINT_DETAIL_MINIMAX_2016_11_12_HPP_\r\n";
+}